@@ -97,6 +97,8 @@ extern "C"{
 
 void Fee_Init(void);
 
+void Fee_SetMode( MemIf_ModeType eMode );
+
 Std_ReturnType Fee_Read
     (
         uint16 uBlockNumber,
@@ -112,6 +114,8 @@ Std_ReturnType Fee_Write
    );
 
 
+void Fee_Cancel( void );
+
 MemIf_StatusType Fee_GetStatus( void );
 
 MemIf_JobResultType Fee_GetJobResult( void );
@@ -139,6 +143,28 @@ Std_ReturnType Fee_ForceSwapOnNextWrite
         uint8 uClrGrpIndex
     );
 
+#if( FEE_WCET_MEASUREMENT == STD_ON )
+uint32 Fee_GetJobWcet( Fee_JobType eJob );
+#endif
+
+#if( FEE_STATISTICS == STD_ON )
+void Fee_GetStatistics( Fee_StatisticsType * pStatistics );
+
+void Fee_ResetStatistics( void );
+#endif
+
+#if( FEE_TRACE == STD_ON )
+const Fee_TraceType * Fee_GetTrace( void );
+
+void Fee_ResetTrace( void );
+#endif
+
+#if( FEE_LATENCY_HISTOGRAM == STD_ON )
+void Fee_GetLatency( Fee_LatencyType * pLatency );
+
+void Fee_ResetLatency( void );
+#endif
+
 extern Fee_BlockInfoType Fee_aBlockInfo[];
 extern Fee_ClusterGroupInfoType  Fee_aClrGrpInfo[];
 extern boolean Job_finish;
@@ -22,8 +22,48 @@
  
  #define FEE_INVALIDATED_VALUE              0x18U 
  
+ /* Size (bytes) of a compact block record without its flag page: block number, checksum and the inline data */
+ #define FEE_COMPACT_HEADER_SIZE             16U 
+ 
  #define FEE_CRT_CFG_NR_OF_BLOCKS              3
 
+ /* Dead space (bytes) of active cluster above which the next write enforces the swap */
+ #define FEE_DEAD_SPACE_SWAP_THRESHOLD       256U 
+
+ /* Work budget of one Fee_MainFunction or Fls notification call: every scheduled
+    job step and every block visited by the swap loops consumes one operation */
+ #define FEE_MAX_OPS_PER_CYCLE               16U 
+
+ /* Measure the worst-case execution time of each Fee job step */
+ #define FEE_WCET_MEASUREMENT                STD_OFF 
+
+ /* Count job steps, flash requests, errors and swaps and time them, see Fee_GetStatistics */
+ #define FEE_STATISTICS                      STD_OFF 
+
+ /* Record job transitions, flash requests and swaps in a RAM ring buffer, see Fee_GetTrace */
+ #define FEE_TRACE                           STD_OFF 
+
+ /* Size (bytes) of the trace ring buffer */
+ #define FEE_TRACE_BUFFER_SIZE               512U 
+
+ /* Log2 latency histograms of Fee_Read, Fee_Write, Fee_InvalidateBlock and Fee_EraseImmediateBlock, see Fee_GetLatency */
+ #define FEE_LATENCY_HISTOGRAM               STD_OFF 
+
+ /* Buckets of each latency histogram, the last one counts all longer latencies */
+ #define FEE_LATENCY_BUCKETS                 24U 
+
+ /* Free-running timestamp used by the WCET measurement, the statistics, the trace and the latency histograms (map to a hardware timer) */
+ #define FEE_GET_TIMESTAMP()                 (0UL) 
+
+ /* Serve Fee_Read while the internal cluster swap erases the target cluster */
+ #define FEE_READ_DURING_ERASE               STD_OFF 
+
+/* Blank-check a cluster before formatting it and skip the erase if already blank */
+ #define FEE_BLANK_CHECK_BEFORE_ERASE        STD_OFF 
+
+/* Compare written block data with the user buffer before validating the block */
+ #define FEE_WRITE_VERIFY                    STD_OFF 
+
 
  #define FEE_MAX_NR_OF_BLOCKS        (FEE_CRT_CFG_NR_OF_BLOCKS) 
  
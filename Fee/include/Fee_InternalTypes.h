@@ -65,6 +65,8 @@ typedef enum
                                           */
     FEE_JOB_WRITE_UNALIGNED_DATA,    /**< @brief Write unaligned rest of Fee
                                           block data to flash */
+    FEE_JOB_WRITE_VERIFY,            /**< @brief Compare written Fee block data
+                                          with the user buffer */
     FEE_JOB_WRITE_VALIDATE,          /**< @brief Validate Fee block by writing
                                           validation flag to flash */
     FEE_JOB_WRITE_DONE,              /**< @brief Finalize validation of Fee
@@ -88,6 +90,8 @@ typedef enum
     FEE_JOB_INT_SCAN_CLR_HDR_PARSE,  /**< @brief Parse Fee cluster header */
     FEE_JOB_INT_SCAN_CLR,            /**< @brief Scan active cluster of current
                                           cluster group */
+    FEE_JOB_INT_SCAN_CLR_BLANK_CHECK,/**< @brief Check whether first Fee cluster
+                                          needs an erase */
     FEE_JOB_INT_SCAN_CLR_FMT,        /**< @brief Format first Fee cluster */
     FEE_JOB_INT_SCAN_CLR_FMT_DONE,   /**< @brief Finalize format of first Fee
                                           cluster */
@@ -97,6 +101,8 @@ typedef enum
 
     FEE_JOB_INT_SWAP_BLOCK,          /**< @brief Copy next block from source to
                                           target cluster */
+    FEE_JOB_INT_SWAP_CLR_BLANK_CHECK,/**< @brief Check whether current Fee
+                                          cluster needs an erase */
     FEE_JOB_INT_SWAP_CLR_FMT,        /**< @brief Format current Fee cluster in
                                           current Fee cluster group */
     FEE_JOB_INT_SWAP_DATA_READ,      /**< @brief Read data from source cluster
@@ -104,11 +110,43 @@ typedef enum
     FEE_JOB_INT_SWAP_DATA_WRITE,     /**< @brief Write data from internal
                                           Fee buffer to target cluster */
     FEE_JOB_INT_SWAP_CLR_VLD_DONE,   /**< @brief Finalize cluster validation */
+    FEE_JOB_INT_SWAP_RESUME_HDR_PARSE,/**< @brief Parse Fee block header already
+                                          copied to the target cluster by an
+                                          interrupted swap */
     /* Fee system jobs */
     FEE_JOB_DONE                     /**< @brief No more subsequent jobs to
                                           schedule */
 } Fee_JobType;
 
+/**
+* @brief        Type of flash request issued by Fee
+* @api
+*/
+typedef enum
+{
+    FEE_FLS_READ = 0,                /**< @brief Fls_Read */
+    FEE_FLS_WRITE,                   /**< @brief Fls_Write */
+    FEE_FLS_ERASE,                   /**< @brief Fls_Erase */
+    FEE_FLS_COMPARE,                 /**< @brief Fls_Compare */
+    FEE_FLS_BLANK_CHECK,             /**< @brief Fls_BlankCheck */
+    FEE_FLS_NONE                     /**< @brief No flash request, number of
+                                          request types */
+} Fee_FlsRequestType;
+
+/**
+* @brief        Fee service accepting a user request
+* @api
+*/
+typedef enum
+{
+    FEE_API_READ = 0,                /**< @brief Fee_Read */
+    FEE_API_WRITE,                   /**< @brief Fee_Write */
+    FEE_API_INVALIDATE_BLOCK,        /**< @brief Fee_InvalidateBlock */
+    FEE_API_ERASE_IMMEDIATE_BLOCK,   /**< @brief Fee_EraseImmediateBlock */
+    FEE_API_NONE                     /**< @brief No user request, number of
+                                          services */
+} Fee_ApiType;
+
 /*==================================================================================================
                                  STRUCTURES AND OTHER TYPEDEFS
 ==================================================================================================*/
@@ -121,8 +159,13 @@ typedef struct
 {
     Fls_AddressType uDataAddrIt;  /**< @brief Address of current Fee data block in flash */
     Fls_AddressType uHdrAddrIt;   /**< @brief Address of current Fee block header in flash */
+    Fls_LengthType uDeadSpace;    /**< @brief Space of active cluster occupied by unusable
+                                              block headers and their data */
     uint32 uActClrID;             /**< @brief ID of active cluster */
     uint8 uActClr;                /**< @brief Index of active cluster */
+    uint32 uSwapClrID;            /**< @brief ID of formatted but not validated cluster
+                                              (target of an interrupted swap) */
+    uint8 uSwapClr;               /**< @brief Index of formatted but not validated cluster */
 } Fee_ClusterGroupInfoType;
 
 /**
@@ -136,6 +179,61 @@ typedef struct
     Fee_BlockStatusType eBlockStatus;   /**< @brief Current status of Fee block */
 } Fee_BlockInfoType;
 
+/**
+* @brief        Fee job and flash request statistics
+* @details      Times are in FEE_GET_TIMESTAMP() ticks.
+* @api
+*/
+typedef struct
+{
+    uint32 au32JobSteps[FEE_JOB_DONE + 1U];     /**< @brief Job steps run per job type */
+    uint32 au32JobTime[FEE_JOB_DONE + 1U];      /**< @brief Execution time of the job steps per job type */
+    uint32 au32FlsRequests[FEE_FLS_NONE];       /**< @brief Flash requests per request type */
+    uint32 au32FlsBytes[FEE_FLS_NONE];          /**< @brief Bytes of the flash requests per request type */
+    uint32 au32FlsErrors[FEE_FLS_NONE];         /**< @brief Flash requests failed per request type */
+    uint32 au32FlsTime[FEE_FLS_NONE];           /**< @brief Time from flash request to completion per request type */
+    uint32 u32Retries;                          /**< @brief Flash errors Fee recovered from by another path */
+    uint32 u32Swaps;                            /**< @brief Cluster swaps started */
+} Fee_StatisticsType;
+
+/**
+* @brief        Fee trace ring buffer
+* @details      Records are stored from uTail up to uHead, wrapping at the end
+*               of au8Buffer. Times are in FEE_GET_TIMESTAMP() ticks.
+* @api
+*/
+typedef struct
+{
+    uint32 u32Magic;                            /**< @brief Marks a Fee trace dump, "FeeT" */
+    uint32 u32LastTime;                         /**< @brief Timestamp of the newest record */
+    uint32 u32Dropped;                          /**< @brief Oldest records overwritten by newer ones */
+    uint16 uHead;                               /**< @brief Index following the newest record */
+    uint16 uTail;                               /**< @brief Index of the oldest record */
+    uint8 au8Buffer[FEE_TRACE_BUFFER_SIZE];     /**< @brief Trace records */
+} Fee_TraceType;
+
+/**
+* @brief        Log2 latency histogram of a Fee service
+* @details      Bucket 0 counts zero latencies, bucket i latencies from 2^(i-1)
+*               to 2^i - 1 and the last bucket all longer latencies.
+* @api
+*/
+typedef struct
+{
+    uint32 au32Ticks[FEE_LATENCY_BUCKETS];      /**< @brief Requests per bucket of Fee_MainFunction calls */
+    uint32 au32Time[FEE_LATENCY_BUCKETS];       /**< @brief Requests per bucket of FEE_GET_TIMESTAMP() ticks */
+} Fee_LatencyHistogramType;
+
+/**
+* @brief        Latency histograms of the user requests per Fee service
+* @api
+*/
+typedef struct
+{
+    Fee_LatencyHistogramType atDirect[FEE_API_NONE];    /**< @brief Requests served without a cluster swap */
+    Fee_LatencyHistogramType atSwap[FEE_API_NONE];      /**< @brief Requests which waited for a cluster swap */
+} Fee_LatencyType;
+
 #ifdef __cplusplus
 }
 #endif
@@ -38,6 +38,20 @@ typedef enum
     FEE_PROJECT_RESERVED        = 0xFF      /** the value is reserved */
 } Fee_BlockAssignmentType;
 
+/**
+* @brief Fee block record format of a cluster group
+* @details The value is stored as version in the cluster header, a cluster
+*          written in another format than configured is not used. Blocks of a
+*          FEE_RECORD_COMPACT group must not be larger than
+*          FEE_COMPACT_HEADER_SIZE - 4 bytes, Fee_Write refuses them.
+* @api
+*/
+typedef enum
+{
+    FEE_RECORD_STANDARD         = 0x00,     /** block header with flags, data area at the cluster end */
+    FEE_RECORD_COMPACT          = 0x01      /** data inline in a FEE_COMPACT_HEADER_SIZE record with one flag page */
+} Fee_RecordFormatType;
+
 /*==================================================================================================
                                  STRUCTURES AND OTHER TYPEDEFS
 ==================================================================================================*/
@@ -99,6 +113,7 @@ typedef struct
      * @brief Size of reserved area in the given cluster group (memory occupied by immediate blocks)
      */
      Fls_LengthType reservedSize;
+    Fee_RecordFormatType recordFormat;  /**< @brief Format of the block records in the cluster group */
 } Fee_ClusterGroupType;
 /**
 * @brief        Fee Configuration type is a stub type, not used, but required by ASR 4.2.2.
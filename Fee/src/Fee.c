@@ -54,6 +54,105 @@ extern "C"{
         (pDeserialPtr) += sizeof(ParamType); \
     } while( 0 );
 
+/* Every call has to leave at least one operation to the block loops after the
+   job step itself has been accounted, otherwise the loops never progress */
+#if( FEE_MAX_OPS_PER_CYCLE < 2U )
+    #error "FEE_MAX_OPS_PER_CYCLE must be at least 2"
+#endif
+
+/* The read is served by parking the Fls erase job, with the erase suspended
+   or running on the other flash bank */
+#if( (FEE_READ_DURING_ERASE == STD_ON) && (FLS_ERASE_SUSPEND == STD_OFF) && (FLS_READ_WHILE_WRITE == STD_OFF) )
+    #error "FEE_READ_DURING_ERASE requires FLS_ERASE_SUSPEND or FLS_READ_WHILE_WRITE"
+#endif
+
+/**
+* @brief        Job following the block data write: compare the written data
+*               first if configured, validate the block otherwise
+*/
+#if( FEE_WRITE_VERIFY == STD_ON )
+    #define FEE_JOB_WRITE_DATA_NEXT     FEE_JOB_WRITE_VERIFY
+#else
+    #define FEE_JOB_WRITE_DATA_NEXT     FEE_JOB_WRITE_VALIDATE
+#endif
+
+/**
+* @brief        Statistics and trace hooks: flash request issued, flash request
+*               completed, swap started, swap ended. Nothing when compiled out
+*
+* @violates @ref Fee_c_REF_1 Function-like macro defined
+*/
+#if( (FEE_STATISTICS == STD_ON) || (FEE_TRACE == STD_ON) )
+    #define FEE_HOOK_FLS_REQUEST( eType, uAddr, uLength )   Fee_HookFlsRequest( (eType), (uAddr), (uLength) )
+    #define FEE_HOOK_FLS_COMPLETION( bError )               Fee_HookFlsCompletion( (bError) )
+    #define FEE_HOOK_SWAP( bEnd )                           Fee_HookSwap( (bEnd) )
+#else
+    #define FEE_HOOK_FLS_REQUEST( eType, uAddr, uLength )   ((void)0)
+    #define FEE_HOOK_FLS_COMPLETION( bError )               ((void)0)
+    #define FEE_HOOK_SWAP( bEnd )                           ((void)0)
+#endif
+
+/**
+* @brief        Trace hook: Fee_eJob changed since the last traced job
+*
+* @violates @ref Fee_c_REF_1 Function-like macro defined
+*/
+#if( FEE_TRACE == STD_ON )
+    #define FEE_HOOK_JOB()                                  Fee_TraceJob()
+#else
+    #define FEE_HOOK_JOB()                                  ((void)0)
+#endif
+
+/**
+* @brief        Record format version (Fee_RecordFormatType) in the upper byte
+*               of the cluster size field of the cluster header. Version 0
+*               keeps the standard format headers unchanged
+*/
+#define FEE_CLUSTER_VERSION_SHIFT   24U
+#define FEE_CLUSTER_SIZE_MASK       0x00FFFFFFUL
+
+/**
+* @brief        Compact record layout: 16-bit block number, 16-bit checksum,
+*               inline block data filled up with the erase pattern to
+*               FEE_COMPACT_HEADER_SIZE, then one flag page. The flag page is
+*               blank until the record is validated or holds
+*               FEE_INVALIDATED_VALUE for an invalidation record
+*/
+#define FEE_COMPACT_DATA_OFFSET     4U
+#define FEE_COMPACT_DATA_SIZE       (FEE_COMPACT_HEADER_SIZE - FEE_COMPACT_DATA_OFFSET)
+#define FEE_COMPACT_RECORD_SIZE     (FEE_COMPACT_HEADER_SIZE + FEE_VIRTUAL_PAGE_SIZE)
+
+#if( (FEE_COMPACT_HEADER_SIZE <= FEE_COMPACT_DATA_OFFSET) || \
+     ((FEE_COMPACT_HEADER_SIZE % FEE_VIRTUAL_PAGE_SIZE) != 0U) || \
+     (FEE_COMPACT_RECORD_SIZE > FEE_DATA_BUFFER_SIZE) )
+    #error "FEE_COMPACT_HEADER_SIZE must be a multiple of FEE_VIRTUAL_PAGE_SIZE above 4 bytes fitting FEE_DATA_BUFFER_SIZE"
+#endif
+
+#if( FEE_TRACE == STD_ON )
+#if( (FEE_TRACE_BUFFER_SIZE < 32U) || (FEE_TRACE_BUFFER_SIZE > 32768U) )
+    #error "FEE_TRACE_BUFFER_SIZE must be between 32 and 32768 bytes"
+#endif
+
+/**
+* @brief        Trace record layout: the first byte holds the record type in
+*               the upper 3 bits and the record length in bytes in the lower
+*               5 bits, followed by the timestamp delta to the previous record
+*               and the payload. The delta, addresses and lengths are stored as
+*               base-128 varints, least significant group first, bit 7 set on
+*               all bytes but the last
+*/
+#define FEE_TRACE_MAGIC             0x54656546UL    /* "FeeT" in little endian */
+#define FEE_TRACE_TYPE_SHIFT        5U
+#define FEE_TRACE_LENGTH_MASK       0x1FU
+#define FEE_TRACE_RECORD_MAX        17U
+
+#define FEE_TRACE_JOB               1U      /* Fee_eJob old, new */
+#define FEE_TRACE_FLS_REQUEST       2U      /* Fee_FlsRequestType, address, length */
+#define FEE_TRACE_FLS_COMPLETION    3U      /* 0 succeeded, 1 failed */
+#define FEE_TRACE_SWAP_START        4U      /* cluster group */
+#define FEE_TRACE_SWAP_END          5U      /* cluster group, new active cluster */
+#endif
+
 /*==================================================================================================
 *                                       LOCAL VARIABLES
 ==================================================================================================*/
@@ -112,6 +211,17 @@ static Fls_AddressType Fee_uJobIntHdrAddr = 0UL;
 */
 static Fls_AddressType Fee_uJobIntDataAddr = 0UL;
 /**
+* @brief        Addresses of Fee blocks already copied to the target cluster.
+*               Used by the swap job to sync the block info once the target
+*               cluster is validated
+*/
+static Fee_BlockInfoType Fee_aJobIntSwapBlockInfo[FEE_MAX_NR_OF_BLOCKS];
+/**
+* @brief        Data extent of the last skipped block header is unknown. Used by
+*               the scan job, reset at the start of each cluster scan
+*/
+static boolean Fee_bJobIntDataExtentUnknown = (boolean)FALSE;
+/**
 * @brief        Internal state of Fee module
 */
 static MemIf_StatusType Fee_eModuleStatus = MEMIF_UNINIT;
@@ -122,6 +232,86 @@ static MemIf_JobResultType Fee_eJobResult = MEMIF_JOB_OK;
 /**
 * @brief        Currently executed job (including internal one)
 */
+static Fee_JobType Fee_eJob = FEE_JOB_DONE;
+/**
+* @brief        Fee job which started internal management job(s) such as swap...
+*/
+static Fee_JobType Fee_eJobIntOriginalJob = FEE_JOB_DONE;
+/**
+* @brief        Operations left in the work budget of the current
+*               Fee_MainFunction or Fls notification call
+*/
+static uint16 Fee_uJobOpBudget = 0U;
+/**
+* @brief        Current job step ran out of budget without starting an Fls
+*               job. Fee_eJob continues in the next step or call
+*/
+static boolean Fee_bJobYield = (boolean)FALSE;
+/**
+* @brief        Fls mode requested by Fee_SetMode during an internal management
+*               operation, forwarded by Fee_MainFunction once Fls is idle
+*/
+static boolean Fee_bModePending = (boolean)FALSE;
+static MemIf_ModeType Fee_eModePending = MEMIF_MODE_SLOW;
+#if( FEE_WCET_MEASUREMENT == STD_ON )
+/**
+* @brief        Longest measured execution time of every Fee job step
+*/
+static uint32 Fee_au32JobWcet[FEE_JOB_DONE + 1U];
+#endif
+#if( FEE_STATISTICS == STD_ON )
+/**
+* @brief        Job step and flash request statistics
+*/
+static Fee_StatisticsType Fee_tStatistics;
+/**
+* @brief        Type and start time of the flash request waiting for completion
+*/
+static Fee_FlsRequestType Fee_eStatFlsPending = FEE_FLS_NONE;
+static uint32 Fee_uStatFlsStart = 0UL;
+#endif
+#if( FEE_TRACE == STD_ON )
+/**
+* @brief        Trace ring buffer, dumped and decoded by Fee/tools/fee_trace.py
+*/
+static Fee_TraceType Fee_tTrace = { FEE_TRACE_MAGIC, 0UL, 0UL, 0U, 0U, { (uint8)0 } };
+/**
+* @brief        Fee_eJob of the last traced job transition
+*/
+static Fee_JobType Fee_eTraceJob = FEE_JOB_DONE;
+#endif
+#if( FEE_LATENCY_HISTOGRAM == STD_ON )
+/**
+* @brief        Latency histograms of the user requests
+*/
+static Fee_LatencyType Fee_tLatency;
+/**
+* @brief        User request being measured, its acceptance time, the
+*               Fee_MainFunction calls since then and whether it hit a swap
+*/
+static Fee_ApiType Fee_eLatencyApi = FEE_API_NONE;
+static uint32 Fee_uLatencyStart = 0UL;
+static uint32 Fee_uLatencyTicks = 0UL;
+static boolean Fee_bLatencySwap = (boolean)FALSE;
+#endif
+#if( FEE_READ_DURING_ERASE == STD_ON )
+/**
+* @brief        Fls read job of a Fee_Read served during the swap erase is pending
+*/
+static boolean Fee_bEraseReadPending = (boolean)FALSE;
+/**
+* @brief        Last user job was a Fee_Read served during the swap erase,
+*               Fee_GetJobResult reports Fee_eEraseReadResult
+*/
+static boolean Fee_bEraseReadLast = (boolean)FALSE;
+/**
+* @brief        Result of the Fee_Read served during the swap erase
+*/
+static MemIf_JobResultType Fee_eEraseReadResult = MEMIF_JOB_OK;
+#endif
+/**
+* @brief        Currently executed job (including internal one)
+*/
 
 
 
@@ -149,6 +339,8 @@ static void Fee_SerializeBlockHdr
         const uint16 uBlockNumber,
 		const uint16 uLength,
 		const Fls_AddressType uTargetAddress,
+		const boolean bImmediateBlock,
+        uint8 * pBlockHdrPtr
     );
 
 static Std_ReturnType Fee_BlankCheck
@@ -178,6 +370,7 @@ static Fee_ClusterStatusType Fee_DeserializeClusterHdr
         uint32 * const pClrID,
         Fls_AddressType * const pStartAddress,
         Fls_LengthType * const pClusteSize,
+        uint8 * const pVersion,
 		const uint8 * pClrHdrPtr
     );
 
@@ -186,9 +379,24 @@ static void Fee_SerializeClusterHdr
         const uint32 uClrID,
 		const Fls_AddressType uStartAddress,
 		const Fls_LengthType uClusteSize,
+        const uint8 uVersion,
         uint8 * pClrHdrPtr
     );
 
+static void Fee_SerializeCompactHdr
+    (
+        const uint16 uBlockNumber,
+        const uint16 uLength,
+        const uint8 * pDataPtr,
+        uint8 * pRecordPtr
+    );
+
+static Fee_BlockStatusType Fee_DeserializeCompactHdr
+    (
+        uint16 * const pBlockNumber,
+        const uint8 * pRecordPtr
+    );
+
 static uint16 Fee_GetBlockIndex
     (
     	const uint16 uBlockNumber
@@ -205,14 +413,20 @@ LOCAL_INLINE uint16 Fee_GetBlockSize
 LOCAL_INLINE uint8 Fee_GetBlockClusterGrp
 (
 	const uint16 uBlockRuntimeInfoIndex
-	uint16 * const pBlockNumber,
-	uint16 * const pLength,
 );
 LOCAL_INLINE boolean Fee_GetBlockImmediate
 (
 	const uint16 uBlockRuntimeInfoIndex
 );
-static uint16 Fee_AlignToVirtualPageSize
+LOCAL_INLINE boolean Fee_IsCompactClrGrp
+(
+    const uint8 uClrGrp
+);
+LOCAL_INLINE Fls_LengthType Fee_GetBlockHdrSize
+(
+    const uint8 uClrGrp
+);
+static uint16 Fee_AlignToVirtualPageSize( uint16 uBlockSize );
 
 static void Fee_CopyDataToPageBuffer
     (
@@ -235,12 +449,30 @@ static MemIf_JobResultType Fee_JobIntSwapClrFmt( void );
 
 static MemIf_JobResultType Fee_JobIntSwapClrErase( void );
 
+#if( FEE_BLANK_CHECK_BEFORE_ERASE == STD_ON )
+static MemIf_JobResultType Fee_JobIntSwapClrBlankCheck( void );
+
+static MemIf_JobResultType Fee_JobIntSwapClrBlankCheckDone
+    (
+        const boolean bBlank
+    );
+#endif
+
 static MemIf_JobResultType Fee_JobIntSwap( void );
 
 static MemIf_JobResultType Fee_JobIntScanBlockHdrRead( void );
 
 static MemIf_JobResultType Fee_JobIntScanClrErase( void );
 
+#if( FEE_BLANK_CHECK_BEFORE_ERASE == STD_ON )
+static MemIf_JobResultType Fee_JobIntScanClrBlankCheck( void );
+
+static MemIf_JobResultType Fee_JobIntScanClrBlankCheckDone
+    (
+        const boolean bBlank
+    );
+#endif
+
 static MemIf_JobResultType Fee_JobIntScanClr( void );
 
 static MemIf_JobResultType Fee_JobIntScanClrFmt( void );
@@ -259,11 +491,13 @@ static MemIf_JobResultType Fee_JobIntScan( void );
 static MemIf_JobResultType Fee_JobIntScanClrHdrParse
     (
 		const boolean bBufferValid
-        uint8 * pTargetPtr,
-		const uint16 uLength
     );
 
 static MemIf_JobResultType Fee_JobRead( void );
+#if( FEE_READ_DURING_ERASE == STD_ON )
+static Std_ReturnType Fee_ReadDuringErase( uint16 uBlockIndex, uint16 uBlockOffset,
+                                           uint8 * pDataBufferPtr, uint16 uLength );
+#endif
 
 static MemIf_JobResultType Fee_JobIntSwapBlockVld( void );
 
@@ -279,14 +513,33 @@ static MemIf_JobResultType Fee_JobIntSwapDataWrite
 
 static MemIf_JobResultType Fee_JobIntSwapClrVldDone( void );
 
+static boolean Fee_JobIntSwapNextBlock( void );
+
+static boolean Fee_JobIntSwapResumeFits( void );
+
+static MemIf_JobResultType Fee_JobIntSwapResumeHdrRead( void );
+
+static MemIf_JobResultType Fee_JobIntSwapResume( void );
+
+static MemIf_JobResultType Fee_JobIntSwapResumeHdrParse
+    (
+        const boolean bBufferValid
+    );
+
 static MemIf_JobResultType Fee_JobWriteHdr( void );
 
 static MemIf_JobResultType Fee_JobWriteData( void );
 
+static MemIf_JobResultType Fee_JobWriteRecord( void );
+
 static MemIf_JobResultType Fee_JobWrite( void );
 
 static MemIf_JobResultType Fee_JobWriteUnalignedData( void );
 
+#if( FEE_WRITE_VERIFY == STD_ON )
+static MemIf_JobResultType Fee_JobWriteVerify( void );
+#endif
+
 static MemIf_JobResultType Fee_JobWriteValidate( void );
 
 static MemIf_JobResultType Fee_JobWriteDone( void );
@@ -299,10 +552,42 @@ static MemIf_JobResultType Fee_JobEraseImmediate( void );
 
 static MemIf_JobResultType Fee_JobEraseImmediateDone( void );
 
+static MemIf_JobResultType Fee_JobScheduleStep( void );
+
 static MemIf_JobResultType Fee_JobSchedule( void );
 
+static boolean Fee_JobConsumeOp( void );
+
 static sint8 Fee_ReservedAreaWritable( void );
 
+#if( (FEE_STATISTICS == STD_ON) || (FEE_TRACE == STD_ON) )
+static void Fee_HookFlsRequest
+    (
+        Fee_FlsRequestType eType,
+        Fls_AddressType uAddr,
+        Fls_LengthType uLength
+    );
+
+static void Fee_HookFlsCompletion( boolean bError );
+
+static void Fee_HookSwap( boolean bEnd );
+#endif
+
+#if( FEE_TRACE == STD_ON )
+static uint8 Fee_TracePutVarint( uint8 * pRecord, uint8 uIndex, uint32 uValue );
+
+static void Fee_TracePut( uint8 uType, const uint8 * pPayload, uint8 uPayloadLength );
+
+static void Fee_TraceJob( void );
+#endif
+
+#if( FEE_LATENCY_HISTOGRAM == STD_ON )
+static uint8 Fee_LatencyBucket( uint32 uValue );
+
+static void Fee_LatencyStart( Fee_ApiType eApi );
+
+static void Fee_LatencyEnd( void );
+#endif
 
 /*==================================================================================================
 *                                       LOCAL FUNCTIONS
@@ -402,7 +687,6 @@ static Std_ReturnType Fee_BlankCheck
     (
         const uint8 * pTargetPtr,
         const uint8 * const pTargetEndPtr
-        uint8 * pTargetEndPtr = NULL_PTR;
     )
 {
      Std_ReturnType uRetVal = (Std_ReturnType)E_OK;
@@ -604,6 +888,7 @@ static Fee_BlockStatusType Fee_DeserializeBlockHdr
 * @param[out]   pClrID                     32-bit cluster ID
 * @param[out]   pStartAddress              Logical address of Fee cluster in Fls address space
 * @param[out]   pClusteSize                Size of Fee cluster in bytes
+* @param[out]   pVersion                   Record format version of Fee cluster
 * @param[in]    pClrHdrPtr                 Pointer to read buffer
 *
 * @return       Fee_ClusterStatusType
@@ -621,6 +906,7 @@ static Fee_ClusterStatusType Fee_DeserializeClusterHdr
         uint32 * const pClrID,
         Fls_AddressType * const pStartAddress,
         Fls_LengthType * const pClusteSize,
+        uint8 * const pVersion,
         const uint8 * pClrHdrPtr
     )
 {
@@ -673,7 +959,7 @@ static Fee_ClusterStatusType Fee_DeserializeClusterHdr
         {
             eRetVal = FEE_CLUSTER_INCONSISTENT;
         }
-        if( ((boolean)TRUE == bFlagValid) && ((boolean)FALSE == bFlagInvalid) )
+        else if( ((boolean)TRUE == bFlagValid) && ((boolean)FALSE == bFlagInvalid) )
         {
             eRetVal = FEE_CLUSTER_VALID;
         }
@@ -683,6 +969,10 @@ static Fee_ClusterStatusType Fee_DeserializeClusterHdr
         }
     }
 
+    /* The checksum covers the size field including the record format version */
+    *pVersion = (uint8)(*pClusteSize >> FEE_CLUSTER_VERSION_SHIFT);
+    *pClusteSize &= FEE_CLUSTER_SIZE_MASK;
+
     return( eRetVal );
 }
 
@@ -692,6 +982,7 @@ static Fee_ClusterStatusType Fee_DeserializeClusterHdr
 * @param[in]    uClrID           32-bit cluster ID
 * @param[in]    uStartAddress    Logical address of Fee cluster in Fls address space
 * @param[in]    uClusteSize      Size of Fee cluster in bytes
+* @param[in]    uVersion         Record format version of Fee cluster
 * @param[out]   pClrHdrPtr       Pointer to write buffer
 *
 * @pre          pClrHdrPtr       pointer must be valid
@@ -700,21 +991,26 @@ static Fee_ClusterStatusType Fee_DeserializeClusterHdr
 static void  Fee_SerializeClusterHdr (const uint32 uClrID,
 									  const Fls_AddressType uStartAddress,
 									  const Fls_LengthType uClusteSize,
+									  const uint8 uVersion,
 									  uint8 * pClrHdrPtr)
 {
     uint32 u32CheckSum = 0UL;
     uint8 * pTargetEndPtr = NULL_PTR;
+    Fls_LengthType uSizeField = 0UL;
 
     pTargetEndPtr = pClrHdrPtr + FEE_CLUSTER_OVERHEAD;
 
+    /* Record format version goes to the upper byte of the size field */
+    uSizeField = uClusteSize | (((Fls_LengthType)uVersion) << FEE_CLUSTER_VERSION_SHIFT);
+
     /* Calculate the cluster header checksum */
-    u32CheckSum = uClrID + uStartAddress + uClusteSize;
+    u32CheckSum = uClrID + uStartAddress + uSizeField;
 
     FEE_SERIALIZE( uClrID, uint32, pClrHdrPtr )
 
     FEE_SERIALIZE( uStartAddress, Fls_AddressType, pClrHdrPtr )
 
-    FEE_SERIALIZE( uClusteSize, Fls_LengthType, pClrHdrPtr )
+    FEE_SERIALIZE( uSizeField, Fls_LengthType, pClrHdrPtr )
 
     FEE_SERIALIZE( u32CheckSum, uint32, pClrHdrPtr )
 
@@ -725,6 +1021,168 @@ static void  Fee_SerializeClusterHdr (const uint32 uClrID,
     }
 }
 
+/**
+* @brief        Serialize compact Fee block record with inline data to write
+*               buffer, without the flag page
+*
+* @param[in]    uBlockNumber     Fee block number
+* @param[in]    uLength          Size of Fee block in bytes
+* @param[in]    pDataPtr         Block data, may point into the data field of
+*                                pRecordPtr. NULL_PTR for a record without data
+* @param[out]   pRecordPtr       Pointer to write buffer
+*
+* @pre          pRecordPtr       pointer must be valid
+* @pre          uLength must be <= FEE_COMPACT_DATA_SIZE, Fee_Write refuses
+*               larger blocks
+*
+*/
+static void Fee_SerializeCompactHdr( const uint16 uBlockNumber,
+                                     const uint16 uLength,
+                                     const uint8 * pDataPtr,
+                                     uint8 * pRecordPtr )
+{
+    uint16 u16CheckSum = 0U;
+    uint8 * pTargetPtr = pRecordPtr + FEE_COMPACT_DATA_OFFSET;
+    uint8 * pDataEndPtr = pTargetPtr + uLength;
+    uint8 * pTargetEndPtr = pRecordPtr + FEE_COMPACT_HEADER_SIZE;
+
+    /* The checksum covers block number, size and data so a resized block
+       or a torn data write is detected */
+    u16CheckSum = (uint16)(uBlockNumber + uLength);
+
+    for( ; pTargetPtr < pDataEndPtr; pTargetPtr++ )
+    {
+        if( NULL_PTR != pDataPtr )
+        {
+            *pTargetPtr = *pDataPtr;
+            pDataPtr++;
+        }
+        else
+        {
+            *pTargetPtr = FEE_ERASED_VALUE;
+        }
+
+        u16CheckSum = (uint16)(u16CheckSum + *pTargetPtr);
+    }
+
+    /* Fill rest of the record header with the erase pattern */
+    for( ; pTargetPtr < pTargetEndPtr; pTargetPtr++ )
+    {
+        *pTargetPtr = FEE_ERASED_VALUE;
+    }
+
+    FEE_SERIALIZE( uBlockNumber, uint16, pRecordPtr )
+
+    FEE_SERIALIZE( u16CheckSum, uint16, pRecordPtr )
+}
+
+/**
+* @brief        Deserialize compact Fee block record from read buffer
+*
+* @param[out]   pBlockNumber             Fee block number
+* @param[in]    pRecordPtr               Pointer to read buffer holding the
+*                                        record and its flag page
+*
+* @return       Fee_BlockStatusType
+* @retval       FEE_BLOCK_VALID          Record is validated
+* @retval       FEE_BLOCK_INVALID        Record invalidates the block
+* @retval       FEE_BLOCK_INCONSISTENT   Record has not been validated
+* @retval       FEE_BLOCK_HEADER_INVALID Record is garbled or belongs to an
+*                                        unknown or resized block
+* @retval       FEE_BLOCK_HEADER_BLANK   Record is filled with FEE_ERASED_VALUE
+*
+* @pre          pRecordPtr               pointer must be valid
+*
+*/
+static Fee_BlockStatusType Fee_DeserializeCompactHdr
+    (
+        uint16 * const pBlockNumber,
+        const uint8 * pRecordPtr
+    )
+{
+     Fee_BlockStatusType eRetVal = FEE_BLOCK_HEADER_INVALID;
+     uint16 u16ReadCheckSum = 0U;
+     uint16 u16CalcCheckSum = 0U;
+     uint16 uBlockIndex = 0U;
+     uint16 uLength = 0U;
+     const uint8 * pDataPtr = NULL_PTR;
+     const uint8 * pFlagPtr = pRecordPtr + FEE_COMPACT_HEADER_SIZE;
+     boolean bFlagValid = (boolean)FALSE;
+     boolean bFlagInvalid = (boolean)FALSE;
+
+    if( Fee_BlankCheck( pRecordPtr, pRecordPtr+FEE_COMPACT_RECORD_SIZE ) == ((Std_ReturnType)E_OK) )
+    {
+        eRetVal = FEE_BLOCK_HEADER_BLANK;
+    }
+    else
+    {
+        FEE_DESERIALIZE( pRecordPtr, *pBlockNumber, uint16 )
+
+        FEE_DESERIALIZE( pRecordPtr, u16ReadCheckSum, uint16 )
+
+        /* The block size isn't recorded, take it from the configuration */
+        uBlockIndex = Fee_GetBlockIndex( *pBlockNumber );
+
+        if( 0xFFFFU != uBlockIndex )
+        {
+            uLength = Fee_GetBlockSize( uBlockIndex );
+        }
+        else
+        {
+            /* Unknown block, its checksum can't be verified */
+        }
+
+        if( (0xFFFFU == uBlockIndex) || (uLength > FEE_COMPACT_DATA_SIZE) )
+        {
+            /* FEE_BLOCK_HEADER_INVALID */
+        }
+        else
+        {
+            u16CalcCheckSum = (uint16)(*pBlockNumber + uLength);
+
+            for( pDataPtr = pRecordPtr; pDataPtr < (pRecordPtr + uLength); pDataPtr++ )
+            {
+                u16CalcCheckSum = (uint16)(u16CalcCheckSum + *pDataPtr);
+            }
+
+            if( u16CalcCheckSum != u16ReadCheckSum )
+            {
+                /* FEE_BLOCK_HEADER_INVALID */
+            }
+            else if( ((Std_ReturnType)E_OK) != Fee_BlankCheck( pRecordPtr + uLength, pFlagPtr ) )
+            {
+                /* FEE_BLOCK_HEADER_INVALID */
+            }
+            else if( ((Std_ReturnType)E_OK) ==
+                     Fee_DeserializeFlag( pFlagPtr, FEE_VALIDATED_VALUE, &bFlagValid )
+                   )
+            {
+                if( (boolean)TRUE == bFlagValid )
+                {
+                    eRetVal = FEE_BLOCK_VALID;
+                }
+                else
+                {
+                    eRetVal = FEE_BLOCK_INCONSISTENT;
+                }
+            }
+            else if( ((Std_ReturnType)E_OK) ==
+                     Fee_DeserializeFlag( pFlagPtr, FEE_INVALIDATED_VALUE, &bFlagInvalid )
+                   )
+            {
+                /* Blank flag page has been handled above */
+                eRetVal = FEE_BLOCK_INVALID;
+            }
+            else
+            {
+                /* FEE_BLOCK_HEADER_INVALID */
+            }
+        }
+    }
+
+    return( eRetVal );
+}
+
 /**
 * @brief        Searches ordered list of Fee blocks and returns index of block
 *               with matching BlockNumber
@@ -816,6 +1274,52 @@ LOCAL_INLINE boolean Fee_GetBlockImmediate(const uint16 uBlockRuntimeInfoIndex)
     return bImmediate;
 }
 /**
+* @brief  Returns whether a cluster group records its blocks in the compact format
+*
+* @param[in]      uClrGrp     index of the cluster group
+* @return         boolean
+* @retval         TRUE if the record format is FEE_RECORD_COMPACT
+* @pre            -
+*/
+LOCAL_INLINE boolean Fee_IsCompactClrGrp(const uint8 uClrGrp)
+{
+    boolean bCompact = (boolean)FALSE;
+
+    if( FEE_RECORD_COMPACT == Fee_ClrGrps[uClrGrp].recordFormat )
+    {
+        bCompact = (boolean)TRUE;
+    }
+    else
+    {
+        /* Standard block headers */
+    }
+
+    return bCompact;
+}
+/**
+* @brief  Returns the size of a block header slot in the header area of a cluster group
+*
+* @param[in]      uClrGrp     index of the cluster group
+* @return         Fls_LengthType
+* @retval         FEE_BLOCK_OVERHEAD or FEE_COMPACT_RECORD_SIZE
+* @pre            -
+*/
+LOCAL_INLINE Fls_LengthType Fee_GetBlockHdrSize(const uint8 uClrGrp)
+{
+    Fls_LengthType uHdrSize = FEE_BLOCK_OVERHEAD;
+
+    if( (boolean)TRUE == Fee_IsCompactClrGrp( uClrGrp ) )
+    {
+        uHdrSize = FEE_COMPACT_RECORD_SIZE;
+    }
+    else
+    {
+        /* Standard block header */
+    }
+
+    return uHdrSize;
+}
+/**
 * @brief        Adjusts passed size so it's integer multiple of pre-configured +
 *               FEE_VIRTUAL_PAGE_SIZE
 *
@@ -927,6 +1431,7 @@ static MemIf_JobResultType Fee_JobIntSwapClrVld( void )
     /* Serialize validation pattern to write buffer */
     Fee_SerializeFlag( Fee_aDataBuffer, FEE_VALIDATED_VALUE );
 
+    FEE_HOOK_FLS_REQUEST( FEE_FLS_WRITE, (uStartAddr+FEE_CLUSTER_OVERHEAD )-(2U*FEE_VIRTUAL_PAGE_SIZE), FEE_VIRTUAL_PAGE_SIZE );
     /* Write validation pattern to flash */
     if( ((Std_ReturnType)E_OK) ==
             Fls_Write( (uStartAddr+FEE_CLUSTER_OVERHEAD )-(2U*FEE_VIRTUAL_PAGE_SIZE),
@@ -943,6 +1448,9 @@ static MemIf_JobResultType Fee_JobIntSwapClrVld( void )
         eRetVal = MEMIF_JOB_FAILED;
     }
 
+    /* Block info of the cluster group is synced from the first block on */
+    Fee_uJobIntBlockIt = 0U;
+
     /* Schedule subsequent Fee job */
     Fee_eJob = FEE_JOB_INT_SWAP_CLR_VLD_DONE;
 
@@ -950,40 +1458,39 @@ static MemIf_JobResultType Fee_JobIntSwapClrVld( void )
 }
 
 /**
-* @brief        Copy next block from source to target cluster
+* @brief        Advance the internal block iterator to the next Fee block
+*               the swap job copies to the target cluster
 *
-* @return       MemIf_JobResultType
-* @retval       MEMIF_JOB_PENDING Underlying Fls accepted the write job
-* @retval       MEMIF_JOB_FAILED Underlying Fls didn't accept the write job
+* @return       boolean
+* @retval       TRUE    Search finished
+* @retval       FALSE   Work budget exhausted, search continues from
+*                       Fee_uJobIntBlockIt in the next job step
 *
-* @pre          Fee_uJobIntBlockIt       must contain index of currently swaped
-*                                        Fee block
-* @pre          Fee_uJobBlockIndex       must contain index of Fee block which
-*                                        caused the swap
-* @pre          Fee_uJobIntClrGrpIt       must contain index of current cluster
+* @pre          Fee_uJobIntClrGrpIt      must contain index of current cluster
 *                                        group
-* @pre          Fee_uJobIntHdrAddr       must contain valid address of Fee block
-*                                        header in target cluster
-*
-* @post         Fee_uJobIntHdrAddr is advanced on to next Fee block
-* @post         Schedule the FEE_JOB_INT_SWAP_DATA_READ, FEE_JOB_INT_SWAP_BLOCK,
-* or            FEE_JOB_INT_SWAP_CLR_VLD_DONE subsequent job
+* @post         Fee_uJobIntBlockIt points to the next valid or inconsistent
+*               Fee block of the current cluster group or is equal to
+*               FEE_CRT_CFG_NR_OF_BLOCKS if there is no such block
 *
-* @implements   Fee_JobIntSwapBlock_Activity
 */
-static MemIf_JobResultType Fee_JobIntSwapBlock( void )
+static boolean Fee_JobIntSwapNextBlock( void )
 {
-     MemIf_JobResultType eRetVal = MEMIF_JOB_OK;
-     Fls_AddressType uDataAddr = 0UL;
-     uint16 uBlockSize = 0U;
-     uint16 uAlignedBlockSize = 0U;
-     uint16 uBlockNumber = 0U;
      uint8 uBlockClusterGrp = 0U;
-     boolean bImmediateBlock = (boolean)FALSE;
+     boolean bRetVal = (boolean)TRUE;
 
-    /* Find first valid or inconsistent block in same cluster group */
     for( ; Fee_uJobIntBlockIt < FEE_CRT_CFG_NR_OF_BLOCKS; Fee_uJobIntBlockIt++ )
     {
+        if( (boolean)FALSE == Fee_JobConsumeOp() )
+        {
+            /* Out of budget, resume from the current block */
+            bRetVal = (boolean)FALSE;
+            break;
+        }
+        else
+        {
+            /* Budget left, visit the block */
+        }
+
         /* get cluster group */
         uBlockClusterGrp = Fee_GetBlockClusterGrp(Fee_uJobIntBlockIt);
         /* process only valid and inconsistent blocks from the current cluster */
@@ -993,7 +1500,6 @@ static MemIf_JobResultType Fee_JobIntSwapBlock( void )
              (FEE_BLOCK_INCONSISTENT_COPY == Fee_aBlockInfo[Fee_uJobIntBlockIt].eBlockStatus)
             )
            )
-
         {
             break;
         }
@@ -1002,11 +1508,119 @@ static MemIf_JobResultType Fee_JobIntSwapBlock( void )
             /* No match. Try next one... */
         }
     }
-    if( FEE_CRT_CFG_NR_OF_BLOCKS == Fee_uJobIntBlockIt )
+
+    return( bRetVal );
+}
+
+/**
+* @brief        Copy next block from source to target cluster
+*
+* @return       MemIf_JobResultType
+* @retval       MEMIF_JOB_PENDING Underlying Fls accepted the write job
+* @retval       MEMIF_JOB_FAILED Underlying Fls didn't accept the write job
+*
+* @pre          Fee_uJobIntBlockIt       must contain index of currently swaped
+*                                        Fee block
+* @pre          Fee_uJobBlockIndex       must contain index of Fee block which
+*                                        caused the swap
+* @pre          Fee_uJobIntClrGrpIt       must contain index of current cluster
+*                                        group
+* @pre          Fee_uJobIntHdrAddr       must contain valid address of Fee block
+*                                        header in target cluster
+*
+* @post         Fee_uJobIntHdrAddr is advanced on to next Fee block
+* @post         Schedule the FEE_JOB_INT_SWAP_DATA_READ, FEE_JOB_INT_SWAP_BLOCK,
+* or            FEE_JOB_INT_SWAP_CLR_VLD_DONE subsequent job
+*
+* @implements   Fee_JobIntSwapBlock_Activity
+*/
+static MemIf_JobResultType Fee_JobIntSwapBlock( void )
+{
+     MemIf_JobResultType eRetVal = MEMIF_JOB_OK;
+     Fls_AddressType uDataAddr = 0UL;
+     uint16 uBlockSize = 0U;
+     uint16 uAlignedBlockSize = 0U;
+     uint16 uBlockNumber = 0U;
+     boolean bImmediateBlock = (boolean)FALSE;
+
+    /* Find first valid or inconsistent block in same cluster group */
+    if( (boolean)FALSE == Fee_JobIntSwapNextBlock() )
+    {
+        /* Out of budget, continue the search in the next job step */
+        Fee_eJob = FEE_JOB_INT_SWAP_BLOCK;
+        Fee_bJobYield = (boolean)TRUE;
+        eRetVal = MEMIF_JOB_PENDING;
+    }
+    else if( FEE_CRT_CFG_NR_OF_BLOCKS == Fee_uJobIntBlockIt )
     {
         /* No more matching blocks. Validate the cluster */
         eRetVal = Fee_JobIntSwapClrVld();
     }
+    else if( (boolean)TRUE == Fee_IsCompactClrGrp( Fee_uJobIntClrGrpIt ) )
+    {
+        uBlockSize = Fee_GetBlockSize(Fee_uJobIntBlockIt);
+        uBlockNumber = Fee_GetBlockNumber(Fee_uJobIntBlockIt);
+
+        /* Compact records have no invalidation field. uInvalidAddr points behind
+           the record so the validation flag is one virtual page below, as in
+           the standard format */
+        Fee_aJobIntSwapBlockInfo[Fee_uJobIntBlockIt].uInvalidAddr =
+            Fee_uJobIntHdrAddr + FEE_COMPACT_RECORD_SIZE;
+
+        if( FEE_BLOCK_VALID == Fee_aBlockInfo[Fee_uJobIntBlockIt].eBlockStatus )
+        {
+            Fee_aJobIntSwapBlockInfo[Fee_uJobIntBlockIt].uDataAddr =
+                Fee_uJobIntHdrAddr + FEE_COMPACT_DATA_OFFSET;
+
+            FEE_HOOK_FLS_REQUEST( FEE_FLS_READ, Fee_aBlockInfo[Fee_uJobIntBlockIt].uDataAddr, uBlockSize );
+            /* Read the block data into the data field of the record buffer */
+            if( ((Std_ReturnType)E_OK) !=
+                    Fls_Read( Fee_aBlockInfo[Fee_uJobIntBlockIt].uDataAddr,
+                              Fee_aDataBuffer+FEE_COMPACT_DATA_OFFSET, uBlockSize
+                            )
+              )
+            {
+                /* Fls read job hasn't been accepted */
+                eRetVal = MEMIF_JOB_FAILED;
+            }
+            else
+            {
+                /* Fls read job has been accepted */
+                eRetVal = MEMIF_JOB_PENDING;
+            }
+
+            /* Write the record once its data is read */
+            Fee_eJob = FEE_JOB_INT_SWAP_DATA_WRITE;
+        }
+        else
+        {
+            /* Inconsistent block is copied as a record without data which
+               is never validated */
+            Fee_aJobIntSwapBlockInfo[Fee_uJobIntBlockIt].uDataAddr = 0U;
+
+            Fee_SerializeCompactHdr( uBlockNumber, uBlockSize, NULL_PTR, Fee_aDataBuffer );
+
+            FEE_HOOK_FLS_REQUEST( FEE_FLS_WRITE, Fee_uJobIntHdrAddr, FEE_COMPACT_HEADER_SIZE );
+            /* Write record to flash */
+            if( ((Std_ReturnType)E_OK) !=
+                    Fls_Write( Fee_uJobIntHdrAddr, Fee_aDataBuffer, FEE_COMPACT_HEADER_SIZE )
+              )
+            {
+                /* Fls write job hasn't been accepted */
+                eRetVal = MEMIF_JOB_FAILED;
+            }
+            else
+            {
+                /* Fls write job has been accepted */
+                eRetVal = MEMIF_JOB_PENDING;
+            }
+
+            /* Move on to next block and record */
+            Fee_uJobIntHdrAddr += FEE_COMPACT_RECORD_SIZE;
+            Fee_uJobIntBlockIt++;
+            Fee_eJob = FEE_JOB_INT_SWAP_BLOCK;
+        }
+    }
     else
     {
         uBlockSize = Fee_GetBlockSize(Fee_uJobIntBlockIt);
@@ -1032,6 +1646,11 @@ static MemIf_JobResultType Fee_JobIntSwapBlock( void )
             uDataAddr = 0U;
         }
 
+        /* Remember where the block lives in the target cluster */
+        Fee_aJobIntSwapBlockInfo[Fee_uJobIntBlockIt].uDataAddr = uDataAddr;
+        Fee_aJobIntSwapBlockInfo[Fee_uJobIntBlockIt].uInvalidAddr =
+            (Fee_uJobIntHdrAddr + FEE_BLOCK_OVERHEAD) - FEE_VIRTUAL_PAGE_SIZE;
+
         /* Serialize block header to the write buffer */
 
         Fee_SerializeBlockHdr( uBlockNumber,
@@ -1053,6 +1672,7 @@ static MemIf_JobResultType Fee_JobIntSwapBlock( void )
             Fee_eJob = FEE_JOB_INT_SWAP_BLOCK;
         }
 
+        FEE_HOOK_FLS_REQUEST( FEE_FLS_WRITE, Fee_uJobIntHdrAddr, FEE_BLOCK_OVERHEAD-(2U*FEE_VIRTUAL_PAGE_SIZE) );
         /* Write header to flash */
         if( ((Std_ReturnType)E_OK) !=
                 Fls_Write( Fee_uJobIntHdrAddr, Fee_aDataBuffer,
@@ -1105,8 +1725,10 @@ static MemIf_JobResultType Fee_JobIntSwapClrFmt( void )
     uActClrID = Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uActClrID;
 
     /* Build cluster header with new uActClrID + 1 */
-    Fee_SerializeClusterHdr( uActClrID+1U, uStartAddr, uLength, Fee_aDataBuffer );
+    Fee_SerializeClusterHdr( uActClrID+1U, uStartAddr, uLength,
+                             (uint8)Fee_ClrGrps[Fee_uJobIntClrGrpIt].recordFormat, Fee_aDataBuffer );
 
+    FEE_HOOK_FLS_REQUEST( FEE_FLS_WRITE, uStartAddr, FEE_CLUSTER_OVERHEAD-(2U*FEE_VIRTUAL_PAGE_SIZE) );
     /* Write the cluster header to flash */
     if( ((Std_ReturnType)E_OK) ==
             Fls_Write( uStartAddr, Fee_aDataBuffer,
@@ -1152,6 +1774,7 @@ static MemIf_JobResultType Fee_JobIntSwapClrErase( void )
 
     uLength = Fee_ClrGrps[Fee_uJobIntClrGrpIt].clrPtr[Fee_uJobIntClrIt].length;
 
+    FEE_HOOK_FLS_REQUEST( FEE_FLS_ERASE, uStartAddr, uLength );
     /* Erase cluster */
     if( ((Std_ReturnType)E_OK) == Fls_Erase( uStartAddr, uLength ) )
     {
@@ -1170,6 +1793,87 @@ static MemIf_JobResultType Fee_JobIntSwapClrErase( void )
     return( eRetVal );
 }
 
+#if( FEE_BLANK_CHECK_BEFORE_ERASE == STD_ON )
+/**
+* @brief        Check whether current Fee cluster in current Fee cluster group
+*               is already blank and can be formatted without an erase
+*
+* @return       MemIf_JobResultType
+* @retval       MEMIF_JOB_PENDING        Underlying Fls accepted the blank check job
+* @retval       MEMIF_JOB_FAILED         Underlying Fls didn't accept the blank
+*                                        check job
+*
+* @pre          Fee_uJobIntClrGrpIt      must contain index of current cluster group
+* @pre          Fee_uJobIntClrIt        must contain index of current cluster
+* @post         Schedule the FEE_JOB_INT_SWAP_CLR_BLANK_CHECK subsequent job
+*
+*/
+static MemIf_JobResultType Fee_JobIntSwapClrBlankCheck( void )
+{
+    MemIf_JobResultType eRetVal = MEMIF_JOB_OK;
+    Fls_AddressType uStartAddr = 0UL;
+    Fls_LengthType uLength = 0UL;
+
+    uStartAddr = Fee_ClrGrps[Fee_uJobIntClrGrpIt].clrPtr[Fee_uJobIntClrIt].startAddr;
+
+    uLength = Fee_ClrGrps[Fee_uJobIntClrGrpIt].clrPtr[Fee_uJobIntClrIt].length;
+
+    FEE_HOOK_FLS_REQUEST( FEE_FLS_BLANK_CHECK, uStartAddr, uLength );
+    /* Blank check cluster */
+    if( ((Std_ReturnType)E_OK) == Fls_BlankCheck( uStartAddr, uLength ) )
+    {
+        /* Fls blank check job has been accepted */
+        eRetVal = MEMIF_JOB_PENDING;
+    }
+    else
+    {
+        /* Fls blank check job hasn't been accepted */
+        eRetVal = MEMIF_JOB_FAILED;
+    }
+
+    /* Schedule blank check done job */
+    Fee_eJob = FEE_JOB_INT_SWAP_CLR_BLANK_CHECK;
+
+    return( eRetVal );
+}
+
+/**
+* @brief        Format current Fee cluster right away if it is blank, erase it
+*               otherwise
+*
+* @param[in]    bBlank                   Fls blank check job succeeded
+*
+* @return       MemIf_JobResultType
+* @retval       MEMIF_JOB_PENDING        Underlying Fls accepted the write or
+*                                        erase job
+* @retval       MEMIF_JOB_FAILED         Underlying Fls didn't accept the job
+*
+* @post         Schedule the FEE_JOB_INT_SWAP_BLOCK or FEE_JOB_INT_SWAP_CLR_FMT
+*               subsequent job
+*
+*/
+static MemIf_JobResultType Fee_JobIntSwapClrBlankCheckDone
+    (
+        const boolean bBlank
+    )
+{
+    MemIf_JobResultType eRetVal = MEMIF_JOB_OK;
+
+    if( (boolean)TRUE == bBlank )
+    {
+        /* Cluster is erased already, skip the erase */
+        eRetVal = Fee_JobIntSwapClrFmt();
+    }
+    else
+    {
+        /* Cluster contains programmed data or the check failed */
+        eRetVal = Fee_JobIntSwapClrErase();
+    }
+
+    return( eRetVal );
+}
+#endif
+
 /**
 * @brief        Initialize the cluster swap internal operation on
 *               current cluster group
@@ -1197,6 +1901,12 @@ static MemIf_JobResultType  Fee_JobIntSwap( void )
 {
     MemIf_JobResultType  eRetVal = MEMIF_JOB_OK;
 
+    FEE_HOOK_SWAP( (boolean)FALSE );
+#if( FEE_LATENCY_HISTOGRAM == STD_ON )
+    /* The user request being measured, if any, waits for the swap */
+    Fee_bLatencySwap = (boolean)TRUE;
+#endif
+
     /* Store type of original job so Fee can re-schedule
         this job once the swap is complete */
     Fee_eJobIntOriginalJob = Fee_eJob;
@@ -1230,8 +1940,333 @@ static MemIf_JobResultType  Fee_JobIntSwap( void )
     /* Move on to the first block header */
     Fee_uJobIntHdrAddr += FEE_CLUSTER_OVERHEAD;
 
+#if( FEE_BLANK_CHECK_BEFORE_ERASE == STD_ON )
+    /* Erase the swap cluster unless it is blank already */
+    eRetVal = Fee_JobIntSwapClrBlankCheck();
+#else
     /* Erase the swap cluster */
     eRetVal = Fee_JobIntSwapClrErase();
+#endif
+
+    return( eRetVal );
+}
+
+/**
+* @brief        Check whether the Fee blocks not copied yet still fit into
+*               the target cluster of a resumed swap
+*
+* @return       boolean
+* @retval       TRUE                     Remaining blocks fit into the target cluster
+* @retval       FALSE                    Remaining blocks don't fit, the swap must
+*                                        be restarted from an erased cluster
+*
+* @pre          Fee_uJobIntBlockIt       must contain index of the first Fee block
+*                                        not copied yet
+* @pre          Fee_uJobIntHdrAddr and Fee_uJobIntDataAddr must point to the free
+*               space of the target cluster
+*
+*/
+static boolean Fee_JobIntSwapResumeFits( void )
+{
+     uint16 uBlockIt = 0U;
+     uint8 uBlockClusterGrp = 0U;
+     Fls_LengthType uNeededSpace = FEE_BLOCK_OVERHEAD;
+     boolean bRetVal = (boolean)FALSE;
+
+    for( uBlockIt = Fee_uJobIntBlockIt; uBlockIt < FEE_CRT_CFG_NR_OF_BLOCKS; uBlockIt++ )
+    {
+        uBlockClusterGrp = Fee_GetBlockClusterGrp(uBlockIt);
+
+        if( Fee_uJobIntClrGrpIt == uBlockClusterGrp )
+        {
+            if( FEE_BLOCK_VALID == Fee_aBlockInfo[uBlockIt].eBlockStatus )
+            {
+                /* Header and data are copied */
+                uNeededSpace += FEE_BLOCK_OVERHEAD +
+                                Fee_AlignToVirtualPageSize( Fee_GetBlockSize(uBlockIt) );
+            }
+            else if( FEE_BLOCK_INCONSISTENT == Fee_aBlockInfo[uBlockIt].eBlockStatus )
+            {
+                /* Only header is copied */
+                uNeededSpace += FEE_BLOCK_OVERHEAD;
+            }
+            else
+            {
+                /* Block is not copied */
+            }
+        }
+    }
+
+    if( (Fee_uJobIntHdrAddr + uNeededSpace) <= Fee_uJobIntDataAddr )
+    {
+        bRetVal = (boolean)TRUE;
+    }
+    else
+    {
+        /* Dead space left by the interrupted swap doesn't leave enough room */
+    }
+
+    return( bRetVal );
+}
+
+/**
+* @brief        Read the Fee block header already copied to the target cluster
+*               by an interrupted swap
+*
+* @return       MemIf_JobResultType
+* @retval       MEMIF_JOB_PENDING        Underlying Fls accepted the read job
+* @retval       MEMIF_JOB_FAILED         Underlying Fls didn't accept the read job
+*
+* @pre          Fee_uJobIntHdrAddr must contain valid logical address of
+*               Fee block header in the target cluster
+* @post         Schedule the FEE_JOB_INT_SWAP_RESUME_HDR_PARSE subsequent job
+*
+*/
+static MemIf_JobResultType Fee_JobIntSwapResumeHdrRead( void )
+{
+     MemIf_JobResultType eRetVal = MEMIF_JOB_OK;
+
+    FEE_HOOK_FLS_REQUEST( FEE_FLS_READ, Fee_uJobIntHdrAddr, FEE_BLOCK_OVERHEAD );
+    /* Read the block header */
+    if( ((Std_ReturnType)E_OK) !=
+            Fls_Read( Fee_uJobIntHdrAddr, Fee_aDataBuffer, FEE_BLOCK_OVERHEAD )
+      )
+    {
+        /* Fls read job hasn't been accepted */
+        eRetVal = MEMIF_JOB_FAILED;
+    }
+    else
+    {
+        /* Fls read job has been accepted */
+        eRetVal = MEMIF_JOB_PENDING;
+    }
+
+    Fee_eJob = FEE_JOB_INT_SWAP_RESUME_HDR_PARSE;
+
+    return( eRetVal );
+}
+
+/**
+* @brief        Resume the cluster swap interrupted by a reset on current
+*               cluster group
+* @details      The target cluster of the interrupted swap is formatted (its
+*               header ID is one above the active cluster ID) but not validated.
+*               Instead of erasing it again, the already copied block headers
+*               are parsed and the swap continues behind the last completely
+*               copied Fee block.
+*
+* @return       MemIf_JobResultType
+* @retval       MEMIF_JOB_PENDING        Underlying Fls accepted the read job
+* @retval       MEMIF_JOB_FAILED         Underlying Fls didn't accept the read job
+*
+* @pre          Fee_uJobIntClrGrpIt      must contain index of current cluster group
+* @pre          Active cluster of current cluster group has been scanned
+*
+* @post         Fee_eJobIntOriginalJob is set to FEE_JOB_INT_SCAN_CLR so the scan
+*               continues once the swap operation is finished
+* @post         Fee internal block iterator Fee_uJobIntBlockIt is set to zero
+* @post         Fee internal cluster iterator Fee_uJobIntClrIt is set to
+*               the target cluster
+* @post         Fee_uJobIntHdrAddr and Fee_uJobIntDataAddr addresses are initialized to
+*               point to the target cluster
+* @post         Schedule read of the first block header in the target cluster
+*
+*/
+static MemIf_JobResultType Fee_JobIntSwapResume( void )
+{
+     MemIf_JobResultType eRetVal = MEMIF_JOB_OK;
+
+    /* Continue the scan once the swap is complete */
+    Fee_eJobIntOriginalJob = FEE_JOB_INT_SCAN_CLR;
+
+    /* Reset the block iterator */
+    Fee_uJobIntBlockIt = 0U;
+
+    /* Target cluster of the interrupted swap */
+    Fee_uJobIntClrIt = Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uSwapClr;
+
+    /* Calculate header and data address iterators */
+    Fee_uJobIntHdrAddr =
+        Fee_ClrGrps[Fee_uJobIntClrGrpIt].clrPtr[Fee_uJobIntClrIt].startAddr;
+
+    Fee_uJobIntDataAddr = Fee_uJobIntHdrAddr +
+        Fee_ClrGrps[Fee_uJobIntClrGrpIt].clrPtr[Fee_uJobIntClrIt].length;
+
+    /* Move on to the first block header */
+    Fee_uJobIntHdrAddr += FEE_CLUSTER_OVERHEAD;
+
+    /* Read the first copied block header */
+    eRetVal = Fee_JobIntSwapResumeHdrRead();
+
+    return( eRetVal );
+}
+
+/**
+* @brief        Parse Fee block header copied to the target cluster by an
+*               interrupted swap
+*
+* @param[in]    bBufferValid             FALSE if previous Fls read job has failed
+*
+* @return       MemIf_JobResultType
+* @retval       MEMIF_JOB_PENDING        Underlying Fls accepted the read, erase
+*                                        or write job
+* @retval       MEMIF_JOB_FAILED         Underlying Fls didn't accept the read,
+*                                        erase or write job
+*
+* @pre          Fee_uJobIntBlockIt       must contain index of the first Fee block
+*                                        not copied yet
+* @pre          Fee_uJobIntHdrAddr       must contain address of the parsed header
+*
+* @post         Completely copied blocks are skipped, headers whose copy was
+*               interrupted are left behind as dead space
+* @post         Continue the swap with the first block not copied yet once the
+*               end of header list is reached
+* @post         Restart the swap from an erased target cluster if the copied
+*               headers don't match the expected swap sequence
+* @post         Keep the FEE_JOB_INT_SWAP_RESUME_HDR_PARSE job and yield if the
+*               work budget is exhausted before the expected block is found
+*
+*/
+static MemIf_JobResultType Fee_JobIntSwapResumeHdrParse
+    (
+        const boolean bBufferValid
+    )
+{
+     MemIf_JobResultType eRetVal = MEMIF_JOB_FAILED;
+     Fee_BlockStatusType eBlockStatus;
+     uint16 uBlockNumber = 0U;
+     uint16 uBlockSize = 0U;
+     Fls_AddressType uDataAddr = 0UL;
+     Fls_AddressType uExpDataAddr = 0UL;
+     boolean bImmediateData = (boolean)FALSE;
+     boolean bRestart = (boolean)FALSE;
+
+    /* Deserialize block header from read buffer */
+    eBlockStatus =
+        /* @violates @ref Fee_c_REF_4 Taking address of near auto variable. */
+        Fee_DeserializeBlockHdr( &uBlockNumber, &uBlockSize, &uDataAddr,  &bImmediateData,
+                                 Fee_aDataBuffer
+                               );
+
+    if( (boolean)FALSE == bBufferValid )
+    {
+        /* Target cluster can't be trusted */
+        bRestart = (boolean)TRUE;
+    }
+    /* Get next block the swap is expected to copy */
+    else if( (boolean)FALSE == Fee_JobIntSwapNextBlock() )
+    {
+        /* Out of budget. The read buffer is kept, parse it again in the next
+           job step with the search continued from Fee_uJobIntBlockIt */
+        Fee_bJobYield = (boolean)TRUE;
+        eRetVal = MEMIF_JOB_PENDING;
+    }
+    else if( FEE_BLOCK_HEADER_BLANK == eBlockStatus )
+    {
+        /* End of copied headers. Continue the swap if the rest still fits */
+        if( (boolean)TRUE == Fee_JobIntSwapResumeFits() )
+        {
+            eRetVal = Fee_JobIntSwapBlock();
+        }
+        else
+        {
+            bRestart = (boolean)TRUE;
+        }
+    }
+    else if( FEE_BLOCK_HEADER_INVALID == eBlockStatus )
+    {
+        /* Header write has been interrupted, no data written yet. Skip the slot */
+        Fee_uJobIntHdrAddr += FEE_BLOCK_OVERHEAD;
+    }
+    else if( (FEE_CRT_CFG_NR_OF_BLOCKS != Fee_uJobIntBlockIt) &&
+             (Fee_GetBlockNumber(Fee_uJobIntBlockIt) == uBlockNumber) &&
+             (Fee_GetBlockSize(Fee_uJobIntBlockIt) == uBlockSize) &&
+             (Fee_GetBlockImmediate(Fee_uJobIntBlockIt) == bImmediateData)
+           )
+    {
+        if( FEE_BLOCK_VALID == Fee_aBlockInfo[Fee_uJobIntBlockIt].eBlockStatus )
+        {
+            uExpDataAddr = Fee_uJobIntDataAddr - Fee_AlignToVirtualPageSize( uBlockSize );
+        }
+        else
+        {
+            /* Inconsistent blocks are copied without data */
+            uExpDataAddr = 0UL;
+        }
+
+        if( uExpDataAddr != uDataAddr )
+        {
+            /* Not the layout the swap job produces */
+            bRestart = (boolean)TRUE;
+        }
+        else if( ((FEE_BLOCK_VALID == eBlockStatus) && (0UL != uDataAddr)) ||
+                 ((FEE_BLOCK_INCONSISTENT == eBlockStatus) && (0UL == uDataAddr))
+               )
+        {
+            /* Block copy has been completed */
+            Fee_aJobIntSwapBlockInfo[Fee_uJobIntBlockIt].uDataAddr = uDataAddr;
+            Fee_aJobIntSwapBlockInfo[Fee_uJobIntBlockIt].uInvalidAddr =
+                (Fee_uJobIntHdrAddr + FEE_BLOCK_OVERHEAD) - FEE_VIRTUAL_PAGE_SIZE;
+
+            if( 0UL != uDataAddr )
+            {
+                Fee_uJobIntDataAddr = uDataAddr;
+            }
+            else
+            {
+                /* No data allocated */
+            }
+
+            Fee_uJobIntBlockIt++;
+            Fee_uJobIntHdrAddr += FEE_BLOCK_OVERHEAD;
+        }
+        else if( FEE_BLOCK_INCONSISTENT == eBlockStatus )
+        {
+            /* Data copy has been interrupted. Leave header and data behind
+               and copy the block once again */
+            Fee_uJobIntDataAddr = uDataAddr;
+            Fee_uJobIntHdrAddr += FEE_BLOCK_OVERHEAD;
+        }
+        else
+        {
+            /* Invalidated block can't be produced by the swap job */
+            bRestart = (boolean)TRUE;
+        }
+    }
+    else
+    {
+        /* Unexpected block */
+        bRestart = (boolean)TRUE;
+    }
+
+    if( (boolean)TRUE == bRestart )
+    {
+        /* Erase the target cluster and swap from scratch */
+        Fee_eJob = FEE_JOB_INT_SCAN_CLR;
+
+        eRetVal = Fee_JobIntSwap();
+    }
+    else if( ((boolean)FALSE == Fee_bJobYield) &&
+             (FEE_JOB_INT_SWAP_RESUME_HDR_PARSE == Fee_eJob)
+           )
+    {
+        if( (Fee_uJobIntHdrAddr + (2U * FEE_BLOCK_OVERHEAD)) > Fee_uJobIntDataAddr )
+        {
+            /* Header area is exhausted */
+            Fee_eJob = FEE_JOB_INT_SCAN_CLR;
+
+            eRetVal = Fee_JobIntSwap();
+        }
+        else
+        {
+            /* Read next header */
+            eRetVal = Fee_JobIntSwapResumeHdrRead();
+        }
+    }
+    else
+    {
+        /* Swap continues */
+    }
 
     return( eRetVal );
 }
@@ -1244,17 +2279,19 @@ static MemIf_JobResultType  Fee_JobIntSwap( void )
 * @retval       MEMIF_JOB_FAILED Underlying Fls didn't accept the read job
 *
 * @pre          Fee_uJobIntAddrIt must contain valid logical address of
-*               Fee block header to read
+*               Fee block header or compact record to read
 * @post         Schedule the FEE_JOB_INT_SCAN_CLR_PARSE subsequent job
 *
 */
 static MemIf_JobResultType Fee_JobIntScanBlockHdrRead( void )
 {
      MemIf_JobResultType eRetVal = MEMIF_JOB_OK;
+     Fls_LengthType uHdrSize = Fee_GetBlockHdrSize( Fee_uJobIntClrGrpIt );
 
-    /* Read the block header */
+    FEE_HOOK_FLS_REQUEST( FEE_FLS_READ, Fee_uJobIntAddrIt, uHdrSize );
+    /* Read the block header or compact record */
     if( ((Std_ReturnType)E_OK) !=
-            Fls_Read( Fee_uJobIntAddrIt, Fee_aDataBuffer, FEE_BLOCK_OVERHEAD )
+            Fls_Read( Fee_uJobIntAddrIt, Fee_aDataBuffer, uHdrSize )
       )
     {
         /* Fls read job hasn't been accepted */
@@ -1295,6 +2332,7 @@ static MemIf_JobResultType Fee_JobIntScanClrErase( void )
 
     uLength = Fee_ClrGrps[Fee_uJobIntClrGrpIt].clrPtr[0].length;
 
+    FEE_HOOK_FLS_REQUEST( FEE_FLS_ERASE, uStartAddr, uLength );
     if( ((Std_ReturnType)E_OK) == Fls_Erase( uStartAddr, uLength ) )
     {
         /* Fls read job has been accepted */
@@ -1312,6 +2350,87 @@ static MemIf_JobResultType Fee_JobIntScanClrErase( void )
     return( eRetVal );
 }
 
+#if( FEE_BLANK_CHECK_BEFORE_ERASE == STD_ON )
+/**
+* @brief        Check whether the first Fee cluster in current Fee cluster group
+*               is already blank and can be formatted without an erase
+*
+* @return       MemIf_JobResultType
+* @retval       MEMIF_JOB_PENDING        Underlying Fls accepted the blank check job
+* @retval       MEMIF_JOB_FAILED         Underlying Fls didn't accept the blank
+*                                        check job
+*
+* @pre          Fee_uJobIntClrGrpIt must contain index of current Fee cluster
+*               group
+* @post         Schedule the FEE_JOB_INT_SCAN_CLR_BLANK_CHECK subsequent job
+*
+*/
+static MemIf_JobResultType Fee_JobIntScanClrBlankCheck( void )
+{
+     MemIf_JobResultType eRetVal = MEMIF_JOB_OK;
+     Fls_AddressType uStartAddr = 0UL;
+     Fls_LengthType uLength = 0UL;
+
+    /* Get address and size of first cluster in the current cluster group */
+    uStartAddr = Fee_ClrGrps[Fee_uJobIntClrGrpIt].clrPtr[0].startAddr;
+
+    uLength = Fee_ClrGrps[Fee_uJobIntClrGrpIt].clrPtr[0].length;
+
+    FEE_HOOK_FLS_REQUEST( FEE_FLS_BLANK_CHECK, uStartAddr, uLength );
+    if( ((Std_ReturnType)E_OK) == Fls_BlankCheck( uStartAddr, uLength ) )
+    {
+        /* Fls blank check job has been accepted */
+        eRetVal = MEMIF_JOB_PENDING;
+    }
+    else
+    {
+        /* Fls blank check job hasn't been accepted */
+        eRetVal = MEMIF_JOB_FAILED;
+    }
+
+    /* Schedule blank check done job */
+    Fee_eJob = FEE_JOB_INT_SCAN_CLR_BLANK_CHECK;
+
+    return( eRetVal );
+}
+
+/**
+* @brief        Format the first Fee cluster right away if it is blank, erase it
+*               otherwise
+*
+* @param[in]    bBlank                   Fls blank check job succeeded
+*
+* @return       MemIf_JobResultType
+* @retval       MEMIF_JOB_PENDING        Underlying Fls accepted the write or
+*                                        erase job
+* @retval       MEMIF_JOB_FAILED         Underlying Fls didn't accept the job
+*
+* @post         Schedule the FEE_JOB_INT_SCAN_CLR_FMT_DONE or
+*               FEE_JOB_INT_SCAN_CLR_FMT subsequent job
+*
+*/
+static MemIf_JobResultType Fee_JobIntScanClrBlankCheckDone
+    (
+        const boolean bBlank
+    )
+{
+    MemIf_JobResultType eRetVal = MEMIF_JOB_OK;
+
+    if( (boolean)TRUE == bBlank )
+    {
+        /* Cluster is erased already, skip the erase */
+        eRetVal = Fee_JobIntScanClrFmt();
+    }
+    else
+    {
+        /* Cluster contains programmed data or the check failed */
+        eRetVal = Fee_JobIntScanClrErase();
+    }
+
+    return( eRetVal );
+}
+#endif
+
 /**
 * @brief        Scan active cluster of current cluster group or erase and format
 *               first cluster if an active cluster can't be found
@@ -1349,7 +2468,11 @@ static MemIf_JobResultType Fee_JobIntScanClr( void )
             /* call the cluster format notification */
             /* No active cluster found in current group so erase and format
                 the first one... */
+#if( FEE_BLANK_CHECK_BEFORE_ERASE == STD_ON )
+            eRetVal = Fee_JobIntScanClrBlankCheck();
+#else
             eRetVal = Fee_JobIntScanClrErase();
+#endif
         }
         else
         {
@@ -1369,6 +2492,12 @@ static MemIf_JobResultType Fee_JobIntScanClr( void )
             uClrLength = Fee_ClrGrps[Fee_uJobIntClrGrpIt].clrPtr[uClrIndex].length;
             Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDataAddrIt = uClrStartAddr + uClrLength;
 
+            /* No dead space found yet */
+            Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDeadSpace = 0UL;
+
+            /* No skipped header yet, nothing left over from a previous or aborted scan */
+            Fee_bJobIntDataExtentUnknown = (boolean)FALSE;
+
             /* Active cluster found so read the first block header */
             eRetVal = Fee_JobIntScanBlockHdrRead();
         }
@@ -1403,13 +2532,15 @@ static MemIf_JobResultType Fee_JobIntScanClrFmt( void )
     uLength = Fee_ClrGrps[Fee_uJobIntClrGrpIt].clrPtr[0].length;
 
     /* Build cluster header with clusterID = 1 */
-    Fee_SerializeClusterHdr( 1U, uStartAddr, uLength, Fee_aDataBuffer );
+    Fee_SerializeClusterHdr( 1U, uStartAddr, uLength,
+                             (uint8)Fee_ClrGrps[Fee_uJobIntClrGrpIt].recordFormat, Fee_aDataBuffer );
 
     /* Make the cluster valid right away as it's empty anyway... */
     Fee_SerializeFlag( (Fee_aDataBuffer+FEE_CLUSTER_OVERHEAD)-(2U*FEE_VIRTUAL_PAGE_SIZE),
                        FEE_VALIDATED_VALUE
                      );
 
+    FEE_HOOK_FLS_REQUEST( FEE_FLS_WRITE, uStartAddr, FEE_CLUSTER_OVERHEAD-FEE_VIRTUAL_PAGE_SIZE );
     /* Write the cluster header to flash */
     if( ((Std_ReturnType)E_OK) ==
             Fls_Write( uStartAddr, Fee_aDataBuffer,
@@ -1475,6 +2606,9 @@ static MemIf_JobResultType Fee_JobIntScanClrFmtDone( void )
     /* Initialize the block data pointer */
     Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDataAddrIt = uClrStartAddr + uClrLength;
 
+    /* Empty cluster has no dead space */
+    Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDeadSpace = 0UL;
+
     /* Move on to next cluster group */
     Fee_uJobIntClrGrpIt++;
 
@@ -1499,13 +2633,18 @@ static MemIf_JobResultType Fee_JobIntScanClrFmtDone( void )
 * @pre          Fee_uJobIntClrGrpIt      must contain index of current Fee
 *                                        cluster group
 *
-* @post         Initialize internal recovery swap operation in case of bogus
-*               Fee block header or failure of previous read job (perhaps ECC failure..)
+* @post         Skip bogus Fee block header or header which couldn't be read
+*               (perhaps ECC failure..) and account the skipped slot and its data
+*               extent as dead space of the active cluster
+* @post         Enforce cluster swap on next write once the dead space exceeds
+*               FEE_DEAD_SPACE_SWAP_THRESHOLD
 * @post         Advance the Fee_uJobIntClrGrpIt iterator to next cluster group in
 *               case of blank Fee block header (end of header list)
+* @post         Resume the swap interrupted by a reset in case of blank Fee block
+*               header and formatted but not validated target cluster
 * @post         Update the eBlockStatus, uDataAddr, and uInvalidAddr block
 *               information and the uHdrAddrIt and uDataAddrIt iterators in case of valid
-*               Fee block header
+*               Fee block header or compact record
 * @post         Schedule the FEE_JOB_INT_SCAN_CLR_PARSE subsequent job in case
 *               of valid Fee block header
 *
@@ -1524,17 +2663,27 @@ static MemIf_JobResultType Fee_JobIntScanBlockHdrParse
      boolean bImmediateData = (boolean)FALSE;
      uint16 uBlockIndex = 0U;
      uint16 uAlignedBlockSize = 0U;
-     uint16 uBlockRuntimeInfoIndex = 0U;
-    /* Internal variable used to trigger a cluster swap. Used by the swap job. */
-    static  boolean bSwapToBePerformed = (boolean)FALSE;
-     boolean bFeeSwapNeeded = (boolean)FALSE;
+     uint16 uMaxBlockSize = 0U;
+     uint8 uSwapClr = 0U;
+     boolean bDataInRange = (boolean)FALSE;
+     boolean bCompact = Fee_IsCompactClrGrp( Fee_uJobIntClrGrpIt );
+     Fls_LengthType uHdrSize = Fee_GetBlockHdrSize( Fee_uJobIntClrGrpIt );
 
-    /* Deserialize block header from read buffer */
-    eBlockStatus =
+    if( (boolean)TRUE == bCompact )
+    {
+        /* Deserialize compact record from read buffer */
         /* @violates @ref Fee_c_REF_4 Taking address of near auto variable. */
-        Fee_DeserializeBlockHdr( &uBlockNumber, &uBlockSize, &uDataAddr,  &bImmediateData,
-                                 Fee_aDataBuffer
-                               );
+        eBlockStatus = Fee_DeserializeCompactHdr( &uBlockNumber, Fee_aDataBuffer );
+    }
+    else
+    {
+        /* Deserialize block header from read buffer */
+        eBlockStatus =
+            /* @violates @ref Fee_c_REF_4 Taking address of near auto variable. */
+            Fee_DeserializeBlockHdr( &uBlockNumber, &uBlockSize, &uDataAddr,  &bImmediateData,
+                                     Fee_aDataBuffer
+                                   );
+    }
 
     if( (FEE_BLOCK_HEADER_INVALID  == eBlockStatus) || ((boolean)FALSE == bBufferValid))
     {
@@ -1542,116 +2691,226 @@ static MemIf_JobResultType Fee_JobIntScanBlockHdrParse
             the Fee_uJobBlockIndex block */
         Fee_uJobBlockIndex = 0xffffU;
 
-        /* Move on to next block header */
-        Fee_uJobIntAddrIt += FEE_BLOCK_OVERHEAD;
+        /* Skip the header slot. Its data (if any) lies between the data of
+           neighbouring headers and is accounted by the next usable header */
+        Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDeadSpace += uHdrSize;
+
+        if( (boolean)FALSE == bCompact )
+        {
+            Fee_bJobIntDataExtentUnknown = (boolean)TRUE;
+        }
+        else
+        {
+            /* Compact record has no data outside the record */
+        }
+
+        /* Move on to next block header */
+        Fee_uJobIntAddrIt += uHdrSize;
+
+        /* Update the block header pointer */
+        Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uHdrAddrIt = Fee_uJobIntAddrIt;
+
+        /* Read next header */
+        eRetVal = Fee_JobIntScanBlockHdrRead();
+
+    }
+    else if( FEE_BLOCK_HEADER_BLANK  == eBlockStatus )
+    {
+        if( ((boolean)TRUE) == Fee_bJobIntDataExtentUnknown )
+        {
+            /* Last header is unusable and data might have been written behind it.
+               Keep the largest block of the cluster group out of the free space */
+            Fee_bJobIntDataExtentUnknown = (boolean)FALSE;
+
+            for( uBlockIndex = 0U; uBlockIndex < FEE_CRT_CFG_NR_OF_BLOCKS; uBlockIndex++ )
+            {
+                if( (Fee_GetBlockClusterGrp(uBlockIndex) == Fee_uJobIntClrGrpIt) &&
+                    (Fee_AlignToVirtualPageSize( Fee_GetBlockSize(uBlockIndex) ) > uMaxBlockSize)
+                  )
+                {
+                    uMaxBlockSize = Fee_AlignToVirtualPageSize( Fee_GetBlockSize(uBlockIndex) );
+                }
+            }
+
+            if( Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDataAddrIt >=
+                (Fee_uJobIntAddrIt + (2U * FEE_BLOCK_OVERHEAD) + uMaxBlockSize)
+              )
+            {
+                Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDataAddrIt -= uMaxBlockSize;
+                Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDeadSpace += uMaxBlockSize;
+            }
+            else
+            {
+                /* Not enough room left, swap on next write */
+                Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDeadSpace = FEE_DEAD_SPACE_SWAP_THRESHOLD + 1U;
+            }
+        }
+
+        /* Only now the uDataAddrIt variable will be updated to cause swap if the
+           cluster holds too much dead space */
+        if( Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDeadSpace > FEE_DEAD_SPACE_SWAP_THRESHOLD )
+        {
+           Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDataAddrIt = Fee_uJobIntAddrIt +
+                                                               (2U * FEE_BLOCK_OVERHEAD);
+        }
+
+        /* Index of cluster the swap job would target */
+        uSwapClr = Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uActClr + 1U;
+
+        if( uSwapClr == Fee_ClrGrps[Fee_uJobIntClrGrpIt].clrCount )
+        {
+            /* Cluster roll over */
+            uSwapClr = 0U;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+
+        if( ((Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uActClrID + 1U) ==
+                Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uSwapClrID) &&
+            (uSwapClr == Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uSwapClr)
+          )
+        {
+            if( (boolean)TRUE == bCompact )
+            {
+                /* Swap of compact records has been interrupted by a reset.
+                   The records are short, swap them again from scratch */
+                Fee_eJob = FEE_JOB_INT_SCAN_CLR;
+
+                eRetVal = Fee_JobIntSwap();
+            }
+            else
+            {
+                /* Swap has been interrupted by a reset. Resume it */
+                eRetVal = Fee_JobIntSwapResume();
+            }
+        }
+        else
+        {
+            /* End of header list so move on to next cluster group */
+            Fee_uJobIntClrGrpIt++;
+
+            eRetVal = Fee_JobIntScanClr();
+        }
+    }
+    else if( (boolean)TRUE == bCompact )
+    {
+        /* Deserialization has found the block in the configuration */
+        uBlockIndex = Fee_GetBlockIndex( uBlockNumber );
+
+        if( Fee_BlockConfig[uBlockIndex].clrGrp == Fee_uJobIntClrGrpIt )
+        {
+            /* Later record of the block supersedes the earlier ones. Compact
+               records have no invalidation field, uInvalidAddr points behind
+               the record so the validation flag is one virtual page below */
+            Fee_aBlockInfo[uBlockIndex].eBlockStatus = eBlockStatus;
+            Fee_aBlockInfo[uBlockIndex].uDataAddr = Fee_uJobIntAddrIt + FEE_COMPACT_DATA_OFFSET;
+            Fee_aBlockInfo[uBlockIndex].uInvalidAddr = Fee_uJobIntAddrIt + FEE_COMPACT_RECORD_SIZE;
+        }
+        else
+        {
+            /* Block moved to another cluster group */
+            Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDeadSpace += FEE_COMPACT_RECORD_SIZE;
+        }
+
+        /* Move on to next record */
+        Fee_uJobIntAddrIt += FEE_COMPACT_RECORD_SIZE;
 
         /* Update the block header pointer */
         Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uHdrAddrIt = Fee_uJobIntAddrIt;
 
-        /* Set swap-to-be-performed flag */
-        bSwapToBePerformed = (boolean)TRUE;
-
-        /* Read next header */
+        /* Read next record */
         eRetVal = Fee_JobIntScanBlockHdrRead();
-
     }
-    else if( FEE_BLOCK_HEADER_BLANK  == eBlockStatus )
+    else
     {
-        /* If SwapToBePerformed is set, it means that last header is corrupted and
-           ONLY now the uDataAddrIt variable will be updated to cause swap. */
-        if( ((boolean)TRUE) == bSwapToBePerformed )
+        uAlignedBlockSize = Fee_AlignToVirtualPageSize( uBlockSize );
+
+        /* Check whether the data pointer points to an acceptable area */
+        if( (uDataAddr <= (Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDataAddrIt-uAlignedBlockSize)) &&
+            (uDataAddr >= (Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uHdrAddrIt+(2U*FEE_BLOCK_OVERHEAD)))
+           )
         {
-           bSwapToBePerformed = (boolean)FALSE;
-           Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDataAddrIt = Fee_uJobIntAddrIt +
-                                                               (2U * FEE_BLOCK_OVERHEAD);
+            bDataInRange = (boolean)TRUE;
+        }
+        else if( (0UL == uDataAddr) && (FEE_BLOCK_INCONSISTENT == eBlockStatus) )
+        {
+            /* Inconsistent block copied by the swap job, no data allocated */
+            bDataInRange = (boolean)TRUE;
+        }
+        else
+        {
+            bDataInRange = (boolean)FALSE;
         }
 
-        /* End of header list so move on to next cluster group */
-        Fee_uJobIntClrGrpIt++;
-
-        eRetVal = Fee_JobIntScanClr();
-    }
-    else
-    {
         /* Look for found block in the block configuration */
         uBlockIndex = Fee_GetBlockIndex( uBlockNumber );
-            if( 0xFFFFU != uBlockIndex)
-            {
 
-                /* prepare index to be used for the runtime info data*/
-                uBlockRuntimeInfoIndex = uBlockIndex;
-
-                uAlignedBlockSize = Fee_AlignToVirtualPageSize( uBlockSize );
-
-                /* Check whether found block belongs to current cluster group,
-                    and its size and type match the configuration,
-                    and its data pointer points to an acceptable area
-                */
-                bFeeSwapNeeded = (boolean)FALSE;
-
-                if ((uDataAddr <=(Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDataAddrIt-uAlignedBlockSize)) &&
-                    (uDataAddr >= (Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uHdrAddrIt+(2U*FEE_BLOCK_OVERHEAD)))
-                   )
-                {
-                    {
-                        if((Fee_BlockConfig[uBlockIndex].clrGrp == Fee_uJobIntClrGrpIt) &&
-                           (Fee_BlockConfig[uBlockIndex].blockSize == uBlockSize) &&
-                           (Fee_BlockConfig[uBlockIndex].immediateData == bImmediateData)
-                          )
-                        {
-                            bFeeSwapNeeded = (boolean)FALSE;
-
-                        }
-                        else
-                        {
-                            bFeeSwapNeeded = (boolean)TRUE;
-                        }
-                    }
-
-                }
-                else
-                {
-                    bFeeSwapNeeded = (boolean)TRUE;
-                }
-                /* check if swap is needed */
-                if( (boolean)FALSE == bFeeSwapNeeded )
-                {
-                    /* Update block run-time information */
-
-                        Fee_aBlockInfo[uBlockRuntimeInfoIndex].eBlockStatus = eBlockStatus;
-                         /* Update the block data pointer */
-                        Fee_aBlockInfo[uBlockRuntimeInfoIndex].uDataAddr = uDataAddr;
-                        Fee_aBlockInfo[uBlockRuntimeInfoIndex].uInvalidAddr =
-                            (Fee_uJobIntAddrIt + FEE_BLOCK_OVERHEAD) -
-                                FEE_VIRTUAL_PAGE_SIZE;
+        if( (boolean)FALSE == bDataInRange )
+        {
+            /* Header doesn't match the FEE algorithm, its data extent can't be trusted */
+            Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDeadSpace += FEE_BLOCK_OVERHEAD;
+            Fee_bJobIntDataExtentUnknown = (boolean)TRUE;
+        }
+        else if( (0xFFFFU != uBlockIndex) &&
+                 (Fee_BlockConfig[uBlockIndex].clrGrp == Fee_uJobIntClrGrpIt) &&
+                 (Fee_BlockConfig[uBlockIndex].blockSize == uBlockSize) &&
+                 (Fee_BlockConfig[uBlockIndex].immediateData == bImmediateData)
+               )
+        {
+            /* Update block run-time information */
+            Fee_aBlockInfo[uBlockIndex].eBlockStatus = eBlockStatus;
+            /* Update the block data pointer */
+            Fee_aBlockInfo[uBlockIndex].uDataAddr = uDataAddr;
+            Fee_aBlockInfo[uBlockIndex].uInvalidAddr =
+                (Fee_uJobIntAddrIt + FEE_BLOCK_OVERHEAD) -
+                    FEE_VIRTUAL_PAGE_SIZE;
+
+            if( 0UL != uDataAddr )
+            {
+                /* Data of skipped headers (if any) is between the previous and this data block */
+                Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDeadSpace +=
+                    Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDataAddrIt - (uDataAddr + uAlignedBlockSize);
 
+                Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDataAddrIt = uDataAddr;
 
+                Fee_bJobIntDataExtentUnknown = (boolean)FALSE;
+            }
+            else
+            {
+                /* No data allocated */
+            }
+        }
+        else
+        {
+            /* Block doesn't match Fee config (removed from Fee config, resized...).
+               Its data extent is known so skip the header and the data */
+            Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDeadSpace += FEE_BLOCK_OVERHEAD;
 
-                        Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDataAddrIt = uDataAddr;
+            if( 0UL != uDataAddr )
+            {
+                Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDeadSpace +=
+                    Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDataAddrIt - uDataAddr;
 
-                }
-                else
-                {
-                    /* Block header doesn't match Fee config or the FEE algorithm...
-                       during next write cluster swap occurs */
-                    bSwapToBePerformed = (boolean)TRUE;
-                }
+                Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDataAddrIt = uDataAddr;
 
+                Fee_bJobIntDataExtentUnknown = (boolean)FALSE;
             }
             else
             {
-                /* Invalid block number (removed from Fee config...) next write cluster swap occurs */
-                bSwapToBePerformed = (boolean)TRUE;
+                /* No data allocated */
             }
+        }
 
-            /* Move on to next block header */
-            Fee_uJobIntAddrIt += FEE_BLOCK_OVERHEAD;
+        /* Move on to next block header */
+        Fee_uJobIntAddrIt += FEE_BLOCK_OVERHEAD;
 
-            /* Update the block header pointer */
-            Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uHdrAddrIt = Fee_uJobIntAddrIt;
+        /* Update the block header pointer */
+        Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uHdrAddrIt = Fee_uJobIntAddrIt;
 
-            /* Read next header */
-            eRetVal = Fee_JobIntScanBlockHdrRead();
+        /* Read next header */
+        eRetVal = Fee_JobIntScanBlockHdrRead();
     }
     return( eRetVal );
 }
@@ -1676,6 +2935,7 @@ static MemIf_JobResultType Fee_JobIntScanClrHdrRead( void )
     /* Get address of current cluster */
     uReadAddress = Fee_ClrGrps[Fee_uJobIntClrGrpIt].clrPtr[Fee_uJobIntClrIt].startAddr;
 
+    FEE_HOOK_FLS_REQUEST( FEE_FLS_READ, uReadAddress, FEE_CLUSTER_OVERHEAD );
     if( ((Std_ReturnType)E_OK) != Fls_Read( uReadAddress, Fee_aDataBuffer, FEE_CLUSTER_OVERHEAD  ) )
     {
         /* Fls read job hasn't been accepted */
@@ -1749,23 +3009,42 @@ static MemIf_JobResultType Fee_JobIntScanClrHdrParse
      Fls_LengthType uClrSize = 0UL;
      Fls_AddressType uCfgStartAddr = 0UL;
      Fls_LengthType uCfgClrSize = 0UL;
+     uint8 uClrVersion = 0U;
+     uint8 uCfgClrVersion = 0U;
 
-    /* Get configured cluster start address and size */
+    /* Get configured cluster start address, size and record format */
     uCfgStartAddr = Fee_ClrGrps[Fee_uJobIntClrGrpIt].clrPtr[Fee_uJobIntClrIt].startAddr;
 
     uCfgClrSize = Fee_ClrGrps[Fee_uJobIntClrGrpIt].clrPtr[Fee_uJobIntClrIt].length;
 
-    eClrStatus = Fee_DeserializeClusterHdr( &uClrID, &uClrStartAddr, &uClrSize, Fee_aDataBuffer );
+    uCfgClrVersion = (uint8)Fee_ClrGrps[Fee_uJobIntClrGrpIt].recordFormat;
 
-    if( ((boolean)TRUE == bBufferValid) && (FEE_CLUSTER_VALID == eClrStatus) &&
-        (uClrStartAddr == uCfgStartAddr) && (uClrSize == uCfgClrSize) &&
-        (uClrID > Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uActClrID)
-      )
+    eClrStatus = Fee_DeserializeClusterHdr( &uClrID, &uClrStartAddr, &uClrSize, &uClrVersion,
+                                            Fee_aDataBuffer
+                                          );
+
+    if( uClrVersion != uCfgClrVersion )
+    {
+        /* Blocks recorded in another format than configured can't be parsed */
+    }
+    else if( ((boolean)TRUE == bBufferValid) && (FEE_CLUSTER_VALID == eClrStatus) &&
+             (uClrStartAddr == uCfgStartAddr) && (uClrSize == uCfgClrSize) &&
+             (uClrID > Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uActClrID)
+           )
     {
         /* Found valid and active cluster */
         Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uActClr = Fee_uJobIntClrIt;
         Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uActClrID = uClrID;
     }
+    else if( ((boolean)TRUE == bBufferValid) && (FEE_CLUSTER_INCONSISTENT == eClrStatus) &&
+             (uClrStartAddr == uCfgStartAddr) && (uClrSize == uCfgClrSize) &&
+             (uClrID > Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uSwapClrID)
+           )
+    {
+        /* Formatted but not validated cluster. Possible target of interrupted swap */
+        Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uSwapClr = Fee_uJobIntClrIt;
+        Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uSwapClrID = uClrID;
+    }
     else
     {
         /* Invalid, inconsistent, or cluster with low ID */
@@ -1829,6 +3108,7 @@ static MemIf_JobResultType Fee_JobRead( void )
     if( FEE_BLOCK_VALID == eBlockStatus )
     {
 
+        FEE_HOOK_FLS_REQUEST( FEE_FLS_READ, uBlockAddress+Fee_uJobBlockOffset, Fee_uJobBlockLength );
         if( ((Std_ReturnType)E_OK) !=
                 Fls_Read( uBlockAddress+Fee_uJobBlockOffset,
                           Fee_pJobReadDataDestPtr, Fee_uJobBlockLength
@@ -1870,6 +3150,90 @@ static MemIf_JobResultType Fee_JobRead( void )
     return( eRetVal );
 }
 
+#if( FEE_READ_DURING_ERASE == STD_ON )
+/**
+* @brief        Read Fee block while the swap erases the target cluster
+*
+* @details      The source cluster and the block information stay untouched
+*               until the target cluster is erased, so the block can be read in
+*               between. Fls parks its erase job for the read job; the job
+*               variables of the swap are left as they are.
+*
+* @param[in]    uBlockIndex      Index of requested Fee block
+* @param[in]    uBlockOffset     Offset in requested Fee block
+* @param[out]   pDataBufferPtr   Pointer to data buffer
+* @param[in]    uLength          Number of bytes to read from requested Fee block
+*
+* @return       Std_ReturnType
+* @retval       E_OK             The read job was accepted
+* @retval       E_NOT_OK         No swap erase pending, a read is already served
+*                                in between, or Fls couldn't park the erase job
+*
+* @post         Fee_GetJobResult reports the result of this read job
+*/
+static Std_ReturnType Fee_ReadDuringErase( uint16 uBlockIndex, uint16 uBlockOffset,
+                                           uint8 * pDataBufferPtr, uint16 uLength )
+{
+    Std_ReturnType uRetVal = (Std_ReturnType)E_OK;
+    Fee_BlockStatusType eBlockStatus = Fee_aBlockInfo[uBlockIndex].eBlockStatus;
+
+    if( (FEE_JOB_INT_SWAP_CLR_FMT != Fee_eJob) ||
+        (MEMIF_JOB_PENDING != Fee_eJobResult) ||
+        ((boolean)TRUE == Fee_bEraseReadPending)
+      )
+    {
+        /* No swap erase in flight to serve the read in between */
+        uRetVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else if( FEE_BLOCK_VALID == eBlockStatus )
+    {
+        FEE_HOOK_FLS_REQUEST( FEE_FLS_READ, Fee_aBlockInfo[uBlockIndex].uDataAddr + uBlockOffset, uLength );
+        if( ((Std_ReturnType)E_OK) !=
+                Fls_Read( Fee_aBlockInfo[uBlockIndex].uDataAddr + uBlockOffset,
+                          pDataBufferPtr, uLength
+                        )
+          )
+        {
+            /* Erase blocks the bank of the block and can't be suspended, read after the swap */
+            uRetVal = (Std_ReturnType)E_NOT_OK;
+        }
+        else
+        {
+            /* Result comes with the Fls job end or job error notification */
+            Fee_bEraseReadPending = (boolean)TRUE;
+            Fee_eEraseReadResult = MEMIF_JOB_PENDING;
+        }
+    }
+    else if( FEE_BLOCK_INVALID == eBlockStatus )
+    {
+        Fee_eEraseReadResult = MEMIF_BLOCK_INVALID;
+    }
+    else if( (FEE_BLOCK_NEVER_WRITTEN == eBlockStatus) ||
+             (FEE_BLOCK_INCONSISTENT == eBlockStatus) ||
+             (FEE_BLOCK_INCONSISTENT_COPY == eBlockStatus)
+           )
+    {
+        Fee_eEraseReadResult = MEMIF_BLOCK_INCONSISTENT;
+    }
+    else
+    {
+        /* Something is wrong... MEMIF_JOB_FAILED */
+        Fee_eEraseReadResult = MEMIF_JOB_FAILED;
+    }
+
+    if( (Std_ReturnType)E_OK == uRetVal )
+    {
+        Fee_bEraseReadLast = (boolean)TRUE;
+    }
+    else
+    {
+        /* Result of the last job stays reported */
+    }
+
+    return( uRetVal );
+}
+#endif
+
 /**
 * @brief        Validate Fee block
 *
@@ -1877,8 +3241,8 @@ static MemIf_JobResultType Fee_JobRead( void )
 * @retval       MEMIF_JOB_PENDING        Underlying Fls accepted the write job
 * @retval       MEMIF_JOB_FAILED         Underlying Fls did not accept write job
 *
-* @pre          Fee_uJobIntHdrAddr must contain address of Fee block header to
-*               validate
+* @pre          Fee_uJobIntHdrAddr must contain address following the Fee block
+*               header or compact record to validate
 * @post         Schedule the FEE_JOB_INT_SWAP_BLOCK subsequent job
 *
 * @implements   Fee_JobIntSwapBlockVld_Activity
@@ -1886,15 +3250,26 @@ static MemIf_JobResultType Fee_JobRead( void )
 static MemIf_JobResultType Fee_JobIntSwapBlockVld( void )
 {
      MemIf_JobResultType eRetVal = MEMIF_JOB_OK;
+     Fls_AddressType uFlagAddr = 0UL;
+
+    if( (boolean)TRUE == Fee_IsCompactClrGrp( Fee_uJobIntClrGrpIt ) )
+    {
+        /* Flag page ends the compact record */
+        uFlagAddr = Fee_uJobIntHdrAddr - FEE_VIRTUAL_PAGE_SIZE;
+    }
+    else
+    {
+        /* Validation flag is followed by the invalidation flag */
+        uFlagAddr = Fee_uJobIntHdrAddr - (2U * FEE_VIRTUAL_PAGE_SIZE);
+    }
 
     /* Serialize validation pattern to buffer */
     Fee_SerializeFlag( Fee_aDataBuffer, FEE_VALIDATED_VALUE );
 
+    FEE_HOOK_FLS_REQUEST( FEE_FLS_WRITE, uFlagAddr, FEE_VIRTUAL_PAGE_SIZE );
     /* Write header to flash */
     if( ((Std_ReturnType)E_OK) !=
-            Fls_Write( Fee_uJobIntHdrAddr-(2U*FEE_VIRTUAL_PAGE_SIZE),
-                       Fee_aDataBuffer, FEE_VIRTUAL_PAGE_SIZE
-                     )
+            Fls_Write( uFlagAddr, Fee_aDataBuffer, FEE_VIRTUAL_PAGE_SIZE )
       )
     {
         /* Fls read job hasn't been accepted */
@@ -1943,14 +3318,22 @@ static MemIf_JobResultType Fee_JobIntSwapDataRead
      uint16 uAlignedBlockSize = 0U;
      uint16 uBlockSize = 0U;
 
-    /* Get size of swaped block */
-    uBlockSize = Fee_GetBlockSize(Fee_uJobIntBlockIt);
+    if( (boolean)TRUE == Fee_IsCompactClrGrp( Fee_uJobIntClrGrpIt ) )
+    {
+        /* Compact record has been written in one go */
+        Fee_uJobBlockLength = 0U;
+    }
+    else
+    {
+        /* Get size of swaped block */
+        uBlockSize = Fee_GetBlockSize(Fee_uJobIntBlockIt);
 
-    /* Get size of swaped block aligned to virtual page boundary */
-    uAlignedBlockSize = Fee_AlignToVirtualPageSize( uBlockSize );
+        /* Get size of swaped block aligned to virtual page boundary */
+        uAlignedBlockSize = Fee_AlignToVirtualPageSize( uBlockSize );
 
-    /* Calculate remaining number of bytes to read */
-    Fee_uJobBlockLength = (Fee_uJobIntDataAddr + uAlignedBlockSize) - Fee_uJobIntAddrIt;
+        /* Calculate remaining number of bytes to read */
+        Fee_uJobBlockLength = (Fee_uJobIntDataAddr + uAlignedBlockSize) - Fee_uJobIntAddrIt;
+    }
 
     if( (boolean)FALSE == bBufferValid )
     {
@@ -1986,6 +3369,7 @@ static MemIf_JobResultType Fee_JobIntSwapDataRead
         uReadAddr = (Fee_aBlockInfo[Fee_uJobIntBlockIt].uDataAddr + Fee_uJobIntAddrIt) -
                        Fee_uJobIntDataAddr;
 
+        FEE_HOOK_FLS_REQUEST( FEE_FLS_READ, uReadAddr, Fee_uJobBlockLength );
         /* Read the block data */
         if( ((Std_ReturnType)E_OK) != Fls_Read( uReadAddr, Fee_aDataBuffer, Fee_uJobBlockLength ) )
         {
@@ -2032,6 +3416,27 @@ static MemIf_JobResultType Fee_JobIntSwapDataWrite
 
     if( bBufferValid )
     {
+        if( (boolean)TRUE == Fee_IsCompactClrGrp( Fee_uJobIntClrGrpIt ) )
+        {
+            /* Complete the record around the data read into its data field */
+            Fee_SerializeCompactHdr( Fee_GetBlockNumber(Fee_uJobIntBlockIt),
+                                     Fee_GetBlockSize(Fee_uJobIntBlockIt),
+                                     Fee_aDataBuffer+FEE_COMPACT_DATA_OFFSET,
+                                     Fee_aDataBuffer
+                                   );
+
+            Fee_uJobIntAddrIt = Fee_uJobIntHdrAddr;
+            Fee_uJobBlockLength = FEE_COMPACT_HEADER_SIZE;
+
+            /* Move on to next record */
+            Fee_uJobIntHdrAddr += FEE_COMPACT_RECORD_SIZE;
+        }
+        else
+        {
+            /* Data chunk read from the source cluster */
+        }
+
+        FEE_HOOK_FLS_REQUEST( FEE_FLS_WRITE, Fee_uJobIntAddrIt, Fee_uJobBlockLength );
         if( ((Std_ReturnType)E_OK) ==
                 Fls_Write( Fee_uJobIntAddrIt, Fee_aDataBuffer, Fee_uJobBlockLength )
           )
@@ -2063,47 +3468,52 @@ static MemIf_JobResultType Fee_JobIntSwapDataWrite
 * @return       MemIf_JobResultType
 * @retval       MEMIF_JOB_PENDING Underlying Fls accepted the write job
 * @retval       MEMIF_JOB_FAILED Underlying Fls didn't accept write job
+* @retval       MEMIF_JOB_CANCELED The write was canceled by Fee_Cancel during
+*                                  the swap, it isn't resumed
 *
 * @pre          Fee_uJobIntClrGrpIt must contain index of current Fee cluster
 *               group
 * @pre          Fee_uJobIntClrIt must contain index of current cluster
+* @pre          Fee_uJobIntBlockIt must contain index of the first Fee block
+*               not synced yet
 * @post         Update the uDataAddr and uInvalidAddr Fee_BlockConfig variables of
 *               all affected (swaped) Fee blocks
 * @post         Update uActClr, uActClrID, uHdrAddrIt, uDataAddrIt Fee_aClrGrpInfo
 *               variables of current cluster group
 * @post         Change Fee module status from MEMIF_BUSYINTERNAL to MEMIF_BUSY
-* @post         Re-schedule the Fee_eJobIntOriginalJob subsequent job
+* @post         Yield to the Fee_eJobIntOriginalJob subsequent job, or keep the
+*               FEE_JOB_INT_SWAP_CLR_VLD_DONE job if the work budget is exhausted
+*               before all blocks are synced
 *
 * @implements   Fee_JobIntSwapClrVldDone_Activity
 */
 static MemIf_JobResultType Fee_JobIntSwapClrVldDone( void )
 {
-     MemIf_JobResultType eRetVal = MEMIF_JOB_OK;
+     MemIf_JobResultType eRetVal = MEMIF_JOB_PENDING;
      uint16 uBlockIt = 0U;
-     Fls_AddressType uHdrAddrIt = 0UL;
-     Fls_AddressType uDataAddrIt = 0UL;
-     uint16 uBlockSize = 0U;
-     uint16 uAlignedBlockSize = 0U;
      uint8 uBlockClusterGrp = 0U;
 
-
-    uHdrAddrIt = Fee_ClrGrps[Fee_uJobIntClrGrpIt].clrPtr[Fee_uJobIntClrIt].startAddr;
-
-    uDataAddrIt = uHdrAddrIt + Fee_ClrGrps[Fee_uJobIntClrGrpIt].clrPtr[Fee_uJobIntClrIt].length;
-
-    /* Move on to the first block header */
-    uHdrAddrIt += FEE_CLUSTER_OVERHEAD;
-
     /* Sync block info */
 
-   for( uBlockIt = 0U; uBlockIt < FEE_CRT_CFG_NR_OF_BLOCKS; uBlockIt++ )
+   for( ; Fee_uJobIntBlockIt < FEE_CRT_CFG_NR_OF_BLOCKS; Fee_uJobIntBlockIt++ )
     {
+        if( (boolean)FALSE == Fee_JobConsumeOp() )
+        {
+            /* Out of budget, sync the rest in the next job step */
+            break;
+        }
+        else
+        {
+            /* Budget left, sync the block */
+        }
+
+        uBlockIt = Fee_uJobIntBlockIt;
         uBlockClusterGrp = Fee_GetBlockClusterGrp(uBlockIt);
 
         if(Fee_uJobIntClrGrpIt == uBlockClusterGrp)
         {
             /* Valid blocks and inconsistent blocks with allocated data were copied,
-               update the block info and internal pointers accordingly.
+               update the block info accordingly.
             */
             if( (FEE_BLOCK_VALID == Fee_aBlockInfo[uBlockIt].eBlockStatus) ||
                 (FEE_BLOCK_INCONSISTENT == Fee_aBlockInfo[uBlockIt].eBlockStatus) ||
@@ -2111,41 +3521,21 @@ static MemIf_JobResultType Fee_JobIntSwapClrVldDone( void )
               )
             {
                 /* Sync uInvalidAddr */
-                Fee_aBlockInfo[uBlockIt].uInvalidAddr = (uHdrAddrIt + FEE_BLOCK_OVERHEAD) -
-                                                         FEE_VIRTUAL_PAGE_SIZE;
-                /* check if block is immediate */
-                /* Update the block data address info */
-                if( (FEE_BLOCK_VALID == Fee_aBlockInfo[ uBlockIt ].eBlockStatus) ||
-                    (FEE_BLOCK_INCONSISTENT_COPY == Fee_aBlockInfo[ uBlockIt ].eBlockStatus)
-                  )
+                Fee_aBlockInfo[uBlockIt].uInvalidAddr = Fee_aJobIntSwapBlockInfo[uBlockIt].uInvalidAddr;
+
+                if( FEE_BLOCK_INCONSISTENT_COPY == Fee_aBlockInfo[ uBlockIt ].eBlockStatus )
                 {
-                    uBlockSize = Fee_GetBlockSize(uBlockIt);
-                    /* Align block size to the virtual page boundary */
-                    uAlignedBlockSize = Fee_AlignToVirtualPageSize( uBlockSize );
-                    /* "Allocate" data already swapped (written to the flash) */
-                    uDataAddrIt -= uAlignedBlockSize;
-                    if( FEE_BLOCK_INCONSISTENT_COPY == Fee_aBlockInfo[ uBlockIt ].eBlockStatus )
-                    {
-                        /* Damaged data read during copy, but already allocated => inconsistent */
-                        Fee_aBlockInfo[ uBlockIt ].eBlockStatus = FEE_BLOCK_INCONSISTENT;
-                        /* Mark inconsistency in the runtime info (no data) for the next swap attempt */
-                        Fee_aBlockInfo[uBlockIt].uDataAddr = 0U;
-                    }
-                    else
-                    {
-                        /* store the data address to the block runtime record */
-                        Fee_aBlockInfo[uBlockIt].uDataAddr = uDataAddrIt;
-                    }
+                    /* Damaged data read during copy, but already allocated => inconsistent */
+                    Fee_aBlockInfo[ uBlockIt ].eBlockStatus = FEE_BLOCK_INCONSISTENT;
+                    /* Mark inconsistency in the runtime info (no data) for the next swap attempt */
+                    Fee_aBlockInfo[uBlockIt].uDataAddr = 0U;
                 }
                 else
                 {
-                    /* (Inconsistent plain block in LEGACY == ON) or
-                       (Inconsistent plain or immediate block in LEGACY == OFF) -- no data written (swapped, allocated)/available */
-                    Fee_aBlockInfo[uBlockIt].uDataAddr = 0U;
+                    /* store the data address to the block runtime record
+                       (zero for inconsistent blocks, no data swapped) */
+                    Fee_aBlockInfo[uBlockIt].uDataAddr = Fee_aJobIntSwapBlockInfo[uBlockIt].uDataAddr;
                 }
-
-                /* Advance the header pointer */
-                uHdrAddrIt += FEE_BLOCK_OVERHEAD;
             }
             else
             {
@@ -2157,29 +3547,50 @@ static MemIf_JobResultType Fee_JobIntSwapClrVldDone( void )
         }
     }
 
-    /* Switch to the new cluster */
-    Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uActClr = Fee_uJobIntClrIt;
-    Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uActClrID++;
-    Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uHdrAddrIt = uHdrAddrIt;
-    Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDataAddrIt = uDataAddrIt;
-
-    /* restore original Fee_eJob */
-    if( FEE_JOB_INT_SCAN_CLR == Fee_eJobIntOriginalJob )
+    if( Fee_uJobIntBlockIt < FEE_CRT_CFG_NR_OF_BLOCKS )
     {
-        Fee_uJobIntClrGrpIt++;
+        /* Keep the FEE_JOB_INT_SWAP_CLR_VLD_DONE job */
+        Fee_bJobYield = (boolean)TRUE;
     }
     else
     {
-        /* Do nothing */
-    }
+        /* Switch to the new cluster */
+        Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uActClr = Fee_uJobIntClrIt;
+        Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uActClrID++;
+        Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uHdrAddrIt = Fee_uJobIntHdrAddr;
+        Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDataAddrIt = Fee_uJobIntDataAddr;
+        Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uDeadSpace = 0UL;
 
-    /* Internal job has finished so transition from MEMIF_BUSYINTERNAL to MEMIF_BUSY */
-    Fee_eModuleStatus = MEMIF_BUSY;
+        FEE_HOOK_SWAP( (boolean)TRUE );
+
+        /* restore original Fee_eJob */
+        if( FEE_JOB_INT_SCAN_CLR == Fee_eJobIntOriginalJob )
+        {
+            Fee_uJobIntClrGrpIt++;
+        }
+        else
+        {
+            /* Do nothing */
+        }
 
-    /* And now cross fingers and re-schedule original job ... */
-    Fee_eJob = Fee_eJobIntOriginalJob;
+        if( FEE_JOB_DONE == Fee_eJobIntOriginalJob )
+        {
+            /* The write was canceled during the swap, end it canceled. Fee_eModuleStatus
+               stays MEMIF_BUSY_INTERNAL, the job end sets it to MEMIF_IDLE without notification */
+            Fee_eJob = FEE_JOB_DONE;
+            eRetVal = MEMIF_JOB_CANCELED;
+        }
+        else
+        {
+            /* Internal job has finished so transition from MEMIF_BUSYINTERNAL to MEMIF_BUSY */
+            Fee_eModuleStatus = MEMIF_BUSY;
 
-    eRetVal = Fee_JobSchedule();
+            /* And now cross fingers and re-schedule original job. The scheduler
+               runs it in the next job step, budget permitting */
+            Fee_eJob = Fee_eJobIntOriginalJob;
+            Fee_bJobYield = (boolean)TRUE;
+        }
+    }
 
     return( eRetVal );
 }
@@ -2226,6 +3637,31 @@ static MemIf_JobResultType Fee_JobWriteHdr( void )
 
 		eRetVal = Fee_JobIntSwap();
 	}
+	else if( (boolean)TRUE == Fee_IsCompactClrGrp( uClrGrpIndex ) )
+	{
+		uHdrAddr = Fee_aClrGrpInfo[uClrGrpIndex].uHdrAddrIt;
+
+		/* Serialize the record with the data inline to the write buffer */
+		Fee_SerializeCompactHdr( Fee_BlockConfig[Fee_uJobBlockIndex].blockNumber,
+								 uBlockSize, Fee_pJobWriteDataDestPtr,
+								 Fee_aDataBuffer
+							   );
+
+		FEE_HOOK_FLS_REQUEST( FEE_FLS_WRITE, uHdrAddr, FEE_COMPACT_HEADER_SIZE );
+		/* Write record to flash */
+		if( ((Std_ReturnType)E_OK) !=
+				Fls_Write( uHdrAddr, Fee_aDataBuffer, FEE_COMPACT_HEADER_SIZE )
+		  )
+		{
+			/* Fls write job hasn't been accepted */
+			eRetVal = MEMIF_JOB_FAILED;
+		}
+		else
+		{
+			/* Fls write job has been accepted */
+			eRetVal = MEMIF_JOB_PENDING;
+		}
+	}
 	else
 	{
 		/* Calculate data and header addresses */
@@ -2239,6 +3675,7 @@ static MemIf_JobResultType Fee_JobWriteHdr( void )
 							   Fee_aDataBuffer
 							 );
 
+		FEE_HOOK_FLS_REQUEST( FEE_FLS_WRITE, uHdrAddr, FEE_BLOCK_OVERHEAD-(2U*FEE_VIRTUAL_PAGE_SIZE) );
 		/* Write header to flash */
 		if( ((Std_ReturnType)E_OK) !=
 				Fls_Write( uHdrAddr, Fee_aDataBuffer,
@@ -2293,6 +3730,7 @@ static MemIf_JobResultType Fee_JobWriteData( void )
     /* Index of cluster group the Fee block belongs to */
     uClrGrpIndex = Fee_BlockConfig[Fee_uJobBlockIndex].clrGrp;
 
+
     /* Get size of Fee block */
     uBlockSize = Fee_BlockConfig[Fee_uJobBlockIndex].blockSize;
 
@@ -2330,7 +3768,7 @@ static MemIf_JobResultType Fee_JobWriteData( void )
 		uWriteLength = FEE_VIRTUAL_PAGE_SIZE;
 
 		/* Schedule write of validation pattern */
-		Fee_eJob = FEE_JOB_WRITE_VALIDATE;
+		Fee_eJob = FEE_JOB_WRITE_DATA_NEXT;
 	}
 	else
 	{
@@ -2341,7 +3779,7 @@ static MemIf_JobResultType Fee_JobWriteData( void )
 			uWriteLength = uBlockSize;
 
 			/* Schedule write of validation pattern */
-			Fee_eJob = FEE_JOB_WRITE_VALIDATE;
+			Fee_eJob = FEE_JOB_WRITE_DATA_NEXT;
 		}
 		else
 		{
@@ -2355,6 +3793,7 @@ static MemIf_JobResultType Fee_JobWriteData( void )
 	/* Use ClrGrp info */
 	uDataAddr = Fee_aClrGrpInfo[uClrGrp].uDataAddrIt;
 
+	FEE_HOOK_FLS_REQUEST( FEE_FLS_WRITE, uDataAddr, uWriteLength );
 	if( ((Std_ReturnType)E_OK) == Fls_Write( uDataAddr, pWriteDataPtr, uWriteLength ) )
 	{
 		/* Fls read job has been accepted */
@@ -2368,6 +3807,54 @@ static MemIf_JobResultType Fee_JobWriteData( void )
     return( eRetVal );
 }
 
+/**
+* @brief        Account the compact record written with the data inline and
+*               go on with its validation
+*
+* @return       MemIf_JobResultType
+* @retval       MEMIF_JOB_PENDING        Underlying Fls accepted the compare or
+*                                        write job
+* @retval       MEMIF_JOB_FAILED         Underlying Fls didn't accept the compare
+*                                        or write job
+*
+* @pre          Fee_uJobBlockIndex       must contain index of Fee block to
+*                                        write to
+* @post         Update uHdrAddrIt Fee_aClrGrpInfo variable of current cluster group
+* @post         Changes eBlockStatus to FEE_BLOCK_INCONSISTENT
+* @post         Schedule FEE_JOB_WRITE_DONE subsequent job, after
+*               FEE_JOB_WRITE_VALIDATE if FEE_WRITE_VERIFY is enabled
+*
+*/
+static MemIf_JobResultType Fee_JobWriteRecord( void )
+{
+    MemIf_JobResultType eRetVal = MEMIF_JOB_OK;
+    Fls_AddressType uHdrAddr = 0U;
+    uint8 uClrGrpIndex = (uint8)0;
+
+    /* Index of cluster group the Fee block belongs to */
+    uClrGrpIndex = Fee_BlockConfig[Fee_uJobBlockIndex].clrGrp;
+
+    uHdrAddr = Fee_aClrGrpInfo[uClrGrpIndex].uHdrAddrIt;
+
+    /* Compact records have no invalidation field, uInvalidAddr points behind
+       the record so the validation flag is one virtual page below */
+    Fee_aBlockInfo[Fee_uJobBlockIndex].uDataAddr = uHdrAddr + FEE_COMPACT_DATA_OFFSET;
+    Fee_aBlockInfo[Fee_uJobBlockIndex].uInvalidAddr = uHdrAddr + FEE_COMPACT_RECORD_SIZE;
+
+    Fee_aBlockInfo[Fee_uJobBlockIndex].eBlockStatus = FEE_BLOCK_INCONSISTENT;
+
+    Fee_aClrGrpInfo[uClrGrpIndex].uHdrAddrIt += FEE_COMPACT_RECORD_SIZE;
+
+    /* No data left to write */
+#if( FEE_WRITE_VERIFY == STD_ON )
+    eRetVal = Fee_JobWriteVerify();
+#else
+    eRetVal = Fee_JobWriteValidate();
+#endif
+
+    return( eRetVal );
+}
+
 /**
 * @brief        Write Fee block to flash
 *
@@ -2391,7 +3878,9 @@ static MemIf_JobResultType Fee_JobWrite( void )
 	eRetVal = Fee_JobWriteHdr();
 
 	/* Schedule next job */
-	if( FEE_JOB_INT_SWAP_CLR_FMT == Fee_eJob )
+	if( (FEE_JOB_INT_SWAP_CLR_FMT == Fee_eJob) ||
+		(FEE_JOB_INT_SWAP_CLR_BLANK_CHECK == Fee_eJob)
+	  )
 	{
 		/* Block din't fit into the cluster.
 		   Cluster swap has been enforced... */
@@ -2444,16 +3933,60 @@ static MemIf_JobResultType  Fee_JobWriteUnalignedData( void )
 	uDataAddr = Fee_aBlockInfo[Fee_uJobBlockIndex].uDataAddr;
 
 
+	FEE_HOOK_FLS_REQUEST( FEE_FLS_WRITE, uDataAddr+uWriteOffset, FEE_VIRTUAL_PAGE_SIZE );
+	if( ((Std_ReturnType)E_OK) ==
+			Fls_Write( uDataAddr+uWriteOffset, Fee_aDataBuffer, FEE_VIRTUAL_PAGE_SIZE )
+	  )
+	{
+		/* Fls write job has been accepted */
+		eRetVal = MEMIF_JOB_PENDING;
+	}
+	else
+	{
+		/* Fls write job hasn't been accepted */
+		eRetVal = MEMIF_JOB_FAILED;
+	}
+
+	/* Schedule write of validation pattern */
+	Fee_eJob = FEE_JOB_WRITE_DATA_NEXT;
+
+    return( eRetVal );
+}
+
+#if( FEE_WRITE_VERIFY == STD_ON )
+/**
+* @brief        Compare the Fee block data written to flash with the user buffer
+* @details      A mismatch ends the write job through the Fls job error
+*               notification and the block stays INCONSISTENT
+*
+* @return       MemIf_JobResultType
+* @retval       MEMIF_JOB_PENDING        Underlying Fls accepted the compare job
+* @retval       MEMIF_JOB_FAILED         Underlying Fls didn't accept compare job
+*
+* @pre          Fee_uJobBlockIndex must contain index of Fee block to write to
+* @pre          Fee_pJobWriteDataDestPtr must contain valid pointer to user buffer
+* @post         Schedule FEE_JOB_WRITE_VALIDATE subsequent job
+*
+*/
+static MemIf_JobResultType Fee_JobWriteVerify( void )
+{
+    MemIf_JobResultType  eRetVal = MEMIF_JOB_OK;
+
+	FEE_HOOK_FLS_REQUEST( FEE_FLS_COMPARE, Fee_aBlockInfo[Fee_uJobBlockIndex].uDataAddr, Fee_BlockConfig[Fee_uJobBlockIndex].blockSize );
+	/* Compare the block data with the user buffer */
 	if( ((Std_ReturnType)E_OK) ==
-			Fls_Write( uDataAddr+uWriteOffset, Fee_aDataBuffer, FEE_VIRTUAL_PAGE_SIZE )
+			Fls_Compare( Fee_aBlockInfo[Fee_uJobBlockIndex].uDataAddr,
+						 Fee_pJobWriteDataDestPtr,
+						 Fee_BlockConfig[Fee_uJobBlockIndex].blockSize
+					   )
 	  )
 	{
-		/* Fls write job has been accepted */
+		/* Fls compare job has been accepted */
 		eRetVal = MEMIF_JOB_PENDING;
 	}
 	else
 	{
-		/* Fls write job hasn't been accepted */
+		/* Fls compare job hasn't been accepted */
 		eRetVal = MEMIF_JOB_FAILED;
 	}
 
@@ -2462,6 +3995,7 @@ static MemIf_JobResultType  Fee_JobWriteUnalignedData( void )
 
     return( eRetVal );
 }
+#endif
 
 /**
 * @brief        Validate Fee block by writing validation flag to flash
@@ -2486,6 +4020,7 @@ static MemIf_JobResultType Fee_JobWriteValidate( void )
 	/* Use Block info */
 	uHdrAddr = Fee_aBlockInfo[Fee_uJobBlockIndex].uInvalidAddr - FEE_VIRTUAL_PAGE_SIZE;
 
+	FEE_HOOK_FLS_REQUEST( FEE_FLS_WRITE, uHdrAddr, FEE_VIRTUAL_PAGE_SIZE );
 	/* Write validation pattern to flash */
 	if( ((Std_ReturnType)E_OK) == Fls_Write( uHdrAddr, Fee_aDataBuffer, FEE_VIRTUAL_PAGE_SIZE) )
 	{
@@ -2537,6 +4072,8 @@ static MemIf_JobResultType  Fee_JobWriteDone( void )
 * @retval       MEMIF_JOB_OK             The Fee block is already invalid
 *
 * @pre          Fee_uJobBlockIndex must contain index of Fee block to invalidate
+* @post         Initialize internal cluster swap sequence if the invalidation
+*               record of a compact cluster group doesn't fit into current cluster
 * @post         Schedule FEE_JOB_DONE or FEE_JOB_INVAL_BLOCK_DONE subsequent
 *               jobs
 *
@@ -2545,6 +4082,8 @@ static MemIf_JobResultType  Fee_JobWriteDone( void )
 static MemIf_JobResultType  Fee_JobInvalBlock( void )
 {
     MemIf_JobResultType  eRetVal = MEMIF_JOB_OK;
+    Fls_AddressType uHdrAddr = 0U;
+    uint8 uClrGrpIndex = Fee_GetBlockClusterGrp(Fee_uJobBlockIndex);
 
     if( FEE_BLOCK_INVALID == Fee_aBlockInfo[Fee_uJobBlockIndex].eBlockStatus )
     {
@@ -2567,11 +4106,56 @@ static MemIf_JobResultType  Fee_JobInvalBlock( void )
             /* Fee job completed */
             eRetVal = MEMIF_JOB_OK;
         }
+        else if( (boolean)TRUE == Fee_IsCompactClrGrp( uClrGrpIndex ) )
+        {
+            /* The flag page of the record may hold the validation flag already.
+               Append an invalidation record instead */
+            if( (boolean)FALSE == (boolean)Fee_ReservedAreaWritable() )
+            {
+                /* The record won't fit into current cluster. Init swap sequence... */
+                Fee_uJobIntClrGrpIt = uClrGrpIndex;
+
+                eRetVal = Fee_JobIntSwap();
+            }
+            else
+            {
+                uHdrAddr = Fee_aClrGrpInfo[uClrGrpIndex].uHdrAddrIt;
+
+                /* Serialize record without data and with the invalidation pattern */
+                Fee_SerializeCompactHdr( Fee_GetBlockNumber(Fee_uJobBlockIndex),
+                                         Fee_GetBlockSize(Fee_uJobBlockIndex),
+                                         NULL_PTR, Fee_aDataBuffer
+                                       );
+                Fee_SerializeFlag( Fee_aDataBuffer+FEE_COMPACT_HEADER_SIZE, FEE_INVALIDATED_VALUE );
+
+                FEE_HOOK_FLS_REQUEST( FEE_FLS_WRITE, uHdrAddr, FEE_COMPACT_RECORD_SIZE );
+                /* Write invalidation record to flash */
+                if( ((Std_ReturnType)E_OK) ==
+                        Fls_Write( uHdrAddr, Fee_aDataBuffer, FEE_COMPACT_RECORD_SIZE )
+                  )
+                {
+                    /* Fls write job has been accepted */
+                    eRetVal = MEMIF_JOB_PENDING;
+                }
+                else
+                {
+                    /* Fls write job hasn't been accepted */
+                    eRetVal = MEMIF_JOB_FAILED;
+                }
+
+                /* Partly written record is skipped by the next scan */
+                Fee_aClrGrpInfo[uClrGrpIndex].uHdrAddrIt += FEE_COMPACT_RECORD_SIZE;
+
+                /* Finalize the invalidation operation */
+                Fee_eJob = FEE_JOB_INVAL_BLOCK_DONE;
+            }
+        }
         else
         {
             /* Serialize invalidation pattern to buffer */
             Fee_SerializeFlag( Fee_aDataBuffer, FEE_INVALIDATED_VALUE );
 
+            FEE_HOOK_FLS_REQUEST( FEE_FLS_WRITE, Fee_aBlockInfo[Fee_uJobBlockIndex].uInvalidAddr, FEE_VIRTUAL_PAGE_SIZE );
             /* Write invalidation pattern to flash */
             if( ((Std_ReturnType)E_OK) ==
                     Fls_Write( Fee_aBlockInfo[Fee_uJobBlockIndex].uInvalidAddr,
@@ -2714,15 +4298,100 @@ static MemIf_JobResultType Fee_JobEraseImmediateDone( void )
 }
 
 /**
-* @brief        Schedule subsequent jobs
+* @brief        Consume one operation of the work budget of the current call
+*
+* @return       boolean
+* @retval       TRUE    Operation consumed
+* @retval       FALSE   Work budget exhausted
+*
+*/
+static boolean Fee_JobConsumeOp( void )
+{
+    boolean bRetVal = (boolean)FALSE;
+
+    if( Fee_uJobOpBudget > 0U )
+    {
+        Fee_uJobOpBudget--;
+        bRetVal = (boolean)TRUE;
+    }
+    else
+    {
+        /* Budget exhausted */
+    }
+
+    return( bRetVal );
+}
+
+/**
+* @brief        Schedule subsequent jobs while the work budget of the current
+*               call lasts
+* @details      Each job step consumes one operation. Job steps which end
+*               without a pending Fls job set Fee_bJobYield, the next step
+*               then follows in the same call if budget is left or in the
+*               next Fee_MainFunction call otherwise.
 *
 * @return       MemIf_JobResultType
 *
 * @pre          Fee_eJob must contain type of job to schedule
+* @pre          Fee_uJobOpBudget must be reloaded by the calling API
 *
 * @implements   Fee_JobSchedule_Activity
 */
 static MemIf_JobResultType Fee_JobSchedule( void )
+{
+    MemIf_JobResultType eRetVal = MEMIF_JOB_FAILED;
+#if( (FEE_WCET_MEASUREMENT == STD_ON) || (FEE_STATISTICS == STD_ON) )
+    Fee_JobType eStepJob = FEE_JOB_DONE;
+    uint32 uStepTime = 0UL;
+#endif
+
+    do
+    {
+        Fee_bJobYield = (boolean)FALSE;
+        (void)Fee_JobConsumeOp();
+
+#if( (FEE_WCET_MEASUREMENT == STD_ON) || (FEE_STATISTICS == STD_ON) )
+        eStepJob = Fee_eJob;
+        uStepTime = FEE_GET_TIMESTAMP();
+#endif
+        FEE_HOOK_JOB();
+        eRetVal = Fee_JobScheduleStep();
+        FEE_HOOK_JOB();
+#if( (FEE_WCET_MEASUREMENT == STD_ON) || (FEE_STATISTICS == STD_ON) )
+        uStepTime = FEE_GET_TIMESTAMP() - uStepTime;
+#endif
+#if( FEE_STATISTICS == STD_ON )
+        Fee_tStatistics.au32JobSteps[eStepJob]++;
+        Fee_tStatistics.au32JobTime[eStepJob] += uStepTime;
+#endif
+#if( FEE_WCET_MEASUREMENT == STD_ON )
+        if( uStepTime > Fee_au32JobWcet[eStepJob] )
+        {
+            Fee_au32JobWcet[eStepJob] = uStepTime;
+        }
+        else
+        {
+            /* Not a new maximum */
+        }
+#endif
+    }
+    while( (MEMIF_JOB_PENDING == eRetVal) &&
+           ((boolean)TRUE == Fee_bJobYield) &&
+           (Fee_uJobOpBudget > 0U)
+         );
+
+    return( eRetVal );
+}
+
+/**
+* @brief        Run a single step of the current job
+*
+* @return       MemIf_JobResultType
+*
+* @pre          Fee_eJob must contain type of job to schedule
+*
+*/
+static MemIf_JobResultType Fee_JobScheduleStep( void )
 {
     MemIf_JobResultType eRetVal = MEMIF_JOB_FAILED;
 
@@ -2738,13 +4407,27 @@ static MemIf_JobResultType Fee_JobSchedule( void )
             break;
 
         case FEE_JOB_WRITE_DATA:
-            eRetVal = Fee_JobWriteData();
+            if( (boolean)TRUE == Fee_IsCompactClrGrp( Fee_GetBlockClusterGrp(Fee_uJobBlockIndex) ) )
+            {
+                /* Data has been written inline with the record */
+                eRetVal = Fee_JobWriteRecord();
+            }
+            else
+            {
+                eRetVal = Fee_JobWriteData();
+            }
             break;
 
         case FEE_JOB_WRITE_UNALIGNED_DATA:
             eRetVal = Fee_JobWriteUnalignedData();
             break;
 
+#if( FEE_WRITE_VERIFY == STD_ON )
+        case FEE_JOB_WRITE_VERIFY:
+            eRetVal = Fee_JobWriteVerify();
+            break;
+#endif
+
         case FEE_JOB_WRITE_VALIDATE:
             eRetVal = Fee_JobWriteValidate();
             break;
@@ -2784,6 +4467,12 @@ static MemIf_JobResultType Fee_JobSchedule( void )
             eRetVal = Fee_JobIntScanClrHdrParse( (boolean)TRUE );
             break;
 
+#if( FEE_BLANK_CHECK_BEFORE_ERASE == STD_ON )
+        case FEE_JOB_INT_SCAN_CLR_BLANK_CHECK:
+            eRetVal = Fee_JobIntScanClrBlankCheckDone( (boolean)TRUE );
+            break;
+#endif
+
         case FEE_JOB_INT_SCAN_CLR_FMT:
             eRetVal = Fee_JobIntScanClrFmt();
             break;
@@ -2797,6 +4486,12 @@ static MemIf_JobResultType Fee_JobSchedule( void )
             break;
 
         /* Swap related jobs */
+#if( FEE_BLANK_CHECK_BEFORE_ERASE == STD_ON )
+        case FEE_JOB_INT_SWAP_CLR_BLANK_CHECK:
+            eRetVal = Fee_JobIntSwapClrBlankCheckDone( (boolean)TRUE );
+            break;
+#endif
+
         case FEE_JOB_INT_SWAP_CLR_FMT:
             eRetVal = Fee_JobIntSwapClrFmt();
             break;
@@ -2817,6 +4512,10 @@ static MemIf_JobResultType Fee_JobSchedule( void )
             eRetVal = Fee_JobIntSwapClrVldDone();
             break;
 
+        case FEE_JOB_INT_SWAP_RESUME_HDR_PARSE:
+            eRetVal = Fee_JobIntSwapResumeHdrParse( (boolean)TRUE );
+            break;
+
         /* if the job is finished switch case will break */
         case FEE_JOB_DONE:
             /* Do nothing */
@@ -2850,6 +4549,7 @@ static sint8  Fee_ReservedAreaWritable( void )
     uint16 uBlockSize = 0U;
     uint16 uAlignedBlockSize = 0U;
     Fls_LengthType uAvailClrSpace = 0UL;
+    Fls_LengthType uWrittenClrSpace = 0UL;
     uint8 uClrGrpIndex = (uint8)0;
     uint32 uReservedSpace = 0UL;
     boolean bImmediateData = (boolean)FALSE;
@@ -2864,11 +4564,27 @@ static sint8  Fee_ReservedAreaWritable( void )
     uAvailClrSpace = Fee_aClrGrpInfo[uClrGrpIndex].uDataAddrIt -
                      Fee_aClrGrpInfo[uClrGrpIndex].uHdrAddrIt;
 
-    /* Get size of Fee block */
-    uBlockSize = Fee_GetBlockSize(Fee_uJobBlockIndex);
+    if( (boolean)TRUE == Fee_IsCompactClrGrp( uClrGrpIndex ) )
+    {
+        /* Compact record takes the place of the data, the separation is kept */
+        uAlignedBlockSize = (uint16)FEE_COMPACT_RECORD_SIZE;
 
-    /* Align Fee block size to the virtual page boundary */
-    uAlignedBlockSize = Fee_AlignToVirtualPageSize( uBlockSize );
+        /* Space behind the record when it was written */
+        uWrittenClrSpace = Fee_aClrGrpInfo[uClrGrpIndex].uDataAddrIt -
+                           Fee_aBlockInfo[Fee_uJobBlockIndex].uInvalidAddr;
+    }
+    else
+    {
+        /* Get size of Fee block */
+        uBlockSize = Fee_GetBlockSize(Fee_uJobBlockIndex);
+
+        /* Align Fee block size to the virtual page boundary */
+        uAlignedBlockSize = Fee_AlignToVirtualPageSize( uBlockSize );
+
+        /* Space between header and data when the block was written */
+        uWrittenClrSpace = Fee_aBlockInfo[Fee_uJobBlockIndex].uDataAddr -
+                           (Fee_aBlockInfo[Fee_uJobBlockIndex].uInvalidAddr + FEE_VIRTUAL_PAGE_SIZE);
+    }
 
     /* Hard Stop condition: One FEE_BLOCK_OVERHEAD must be left blank to have a clear separation
        between header block space and data block space */
@@ -2880,49 +4596,330 @@ static sint8  Fee_ReservedAreaWritable( void )
              uAvailClrSpace
            )
     {
-        bImmediateData = Fee_GetBlockImmediate(Fee_uJobBlockIndex);
-        /* Block targets reserved area */
-        if( (boolean)TRUE == bImmediateData )
+        bImmediateData = Fee_GetBlockImmediate(Fee_uJobBlockIndex);
+        /* Block targets reserved area */
+        if( (boolean)TRUE == bImmediateData )
+        {
+            /* Immediate block - only writable if not already present in the reserved area */
+            if( (0UL == Fee_aBlockInfo[Fee_uJobBlockIndex].uDataAddr) &&
+                (0UL == Fee_aBlockInfo[Fee_uJobBlockIndex].uInvalidAddr)
+              )
+            {
+                /* The block is not written in the cluster at all => writable */
+                sRetVal = TRUE;
+            }
+            else
+            {
+                /* The block is written in the cluster - is it written in the reserved area? */
+                if( (FEE_BLOCK_OVERHEAD + uReservedSpace) > uWrittenClrSpace )
+                {
+                    /* The block is already written in the reserved area */
+                    sRetVal = FALSE;
+                }
+                else
+                {
+                   /* The block is not written in the reserved area */
+                   sRetVal = TRUE;
+                }
+            }
+        }
+        else
+        {
+            sRetVal = FALSE;
+        }
+    }
+    else
+    {
+        /* Block does not target reserved area */
+        sRetVal = TRUE;
+    }
+    return sRetVal;
+}
+
+#if( (FEE_STATISTICS == STD_ON) || (FEE_TRACE == STD_ON) )
+/**
+* @brief        Count and trace a flash request and remember it for its
+*               completion
+*
+* @param[in]    eType       Type of the flash request
+* @param[in]    uAddr       Flash address of the flash request
+* @param[in]    uLength     Number of bytes of the flash request
+*
+*/
+static void Fee_HookFlsRequest
+    (
+        Fee_FlsRequestType eType,
+        Fls_AddressType uAddr,
+        Fls_LengthType uLength
+    )
+{
+#if( FEE_TRACE == STD_ON )
+    uint8 aPayload[FEE_TRACE_RECORD_MAX];
+    uint8 uPayloadLength = 0U;
+#endif
+
+#if( FEE_STATISTICS == STD_ON )
+    Fee_tStatistics.au32FlsRequests[eType]++;
+    Fee_tStatistics.au32FlsBytes[eType] += uLength;
+
+    Fee_eStatFlsPending = eType;
+    Fee_uStatFlsStart = FEE_GET_TIMESTAMP();
+#endif
+#if( FEE_TRACE == STD_ON )
+    /* The job step issuing the request shows up before the request */
+    Fee_TraceJob();
+
+    aPayload[0] = (uint8)eType;
+    uPayloadLength = Fee_TracePutVarint( aPayload, 1U, uAddr );
+    uPayloadLength = Fee_TracePutVarint( aPayload, uPayloadLength, uLength );
+    Fee_TracePut( FEE_TRACE_FLS_REQUEST, aPayload, uPayloadLength );
+#else
+    (void)uAddr;
+#endif
+}
+
+/**
+* @brief        Account and trace the completion of the pending flash request
+*
+* @param[in]    bError      The flash request failed
+*
+*/
+static void Fee_HookFlsCompletion( boolean bError )
+{
+#if( FEE_TRACE == STD_ON )
+    uint8 uResult = ((boolean)TRUE == bError) ? 1U : 0U;
+
+    Fee_TracePut( FEE_TRACE_FLS_COMPLETION, &uResult, 1U );
+#endif
+#if( FEE_STATISTICS == STD_ON )
+    if( FEE_FLS_NONE != Fee_eStatFlsPending )
+    {
+        Fee_tStatistics.au32FlsTime[Fee_eStatFlsPending] += FEE_GET_TIMESTAMP() - Fee_uStatFlsStart;
+
+        if( (boolean)TRUE == bError )
+        {
+            Fee_tStatistics.au32FlsErrors[Fee_eStatFlsPending]++;
+        }
+        else
+        {
+            /* Request succeeded */
+        }
+
+        Fee_eStatFlsPending = FEE_FLS_NONE;
+    }
+    else
+    {
+        /* Completion of an erase parked for a read during the swap,
+           the read has already been accounted */
+    }
+#else
+    (void)bError;
+#endif
+}
+
+/**
+* @brief        Count and trace the start or the end of a cluster swap
+*
+* @param[in]    bEnd        The swap of Fee_uJobIntClrGrpIt switched to the
+*                           new cluster, the swap starts otherwise
+*
+*/
+static void Fee_HookSwap( boolean bEnd )
+{
+#if( FEE_TRACE == STD_ON )
+    uint8 aPayload[2U];
+#endif
+
+    if( (boolean)TRUE == bEnd )
+    {
+#if( FEE_TRACE == STD_ON )
+        aPayload[0] = Fee_uJobIntClrGrpIt;
+        aPayload[1] = Fee_aClrGrpInfo[Fee_uJobIntClrGrpIt].uActClr;
+        Fee_TracePut( FEE_TRACE_SWAP_END, aPayload, 2U );
+#endif
+    }
+    else
+    {
+#if( FEE_STATISTICS == STD_ON )
+        Fee_tStatistics.u32Swaps++;
+#endif
+#if( FEE_TRACE == STD_ON )
+        Fee_TraceJob();
+        aPayload[0] = Fee_uJobIntClrGrpIt;
+        Fee_TracePut( FEE_TRACE_SWAP_START, aPayload, 1U );
+#endif
+    }
+}
+#endif
+
+#if( FEE_TRACE == STD_ON )
+/**
+* @brief        Encode a value as base-128 varint into a trace record
+*
+* @param[out]   pRecord     Trace record
+* @param[in]    uIndex      Index of the first varint byte in pRecord
+* @param[in]    uValue      Value to encode
+*
+* @return       uint8       Index following the last varint byte
+*
+*/
+static uint8 Fee_TracePutVarint( uint8 * pRecord, uint8 uIndex, uint32 uValue )
+{
+    uint8 uRetVal = uIndex;
+    uint32 uRest = uValue;
+
+    while( uRest > 0x7FUL )
+    {
+        pRecord[uRetVal] = (uint8)(uRest | 0x80UL);
+        uRest >>= 7U;
+        uRetVal++;
+    }
+    pRecord[uRetVal] = (uint8)uRest;
+    uRetVal++;
+
+    return( uRetVal );
+}
+
+/**
+* @brief        Append a record to the trace ring buffer
+* @details      The oldest records are dropped as long as the new record does
+*               not fit. One byte of the buffer stays unused so a full buffer
+*               can be told from an empty one.
+*
+* @param[in]    uType           Record type
+* @param[in]    pPayload        Record payload
+* @param[in]    uPayloadLength  Number of payload bytes
+*
+*/
+static void Fee_TracePut( uint8 uType, const uint8 * pPayload, uint8 uPayloadLength )
+{
+    uint8 aRecord[FEE_TRACE_RECORD_MAX];
+    uint8 uLength = 0U;
+    uint8 uIt = 0U;
+    uint32 uTime = 0UL;
+    uint16 uUsed = 0U;
+
+    /* Start of exclusive area. Implementation depends on integrator. */
+    uTime = FEE_GET_TIMESTAMP();
+    uLength = Fee_TracePutVarint( aRecord, 1U, uTime - Fee_tTrace.u32LastTime );
+    for( uIt = 0U; uIt < uPayloadLength; uIt++ )
+    {
+        aRecord[uLength] = pPayload[uIt];
+        uLength++;
+    }
+    aRecord[0] = (uint8)((uint8)(uType << FEE_TRACE_TYPE_SHIFT) | uLength);
+
+    /* Drop the oldest records to make room */
+    uUsed = (uint16)((Fee_tTrace.uHead + FEE_TRACE_BUFFER_SIZE) - Fee_tTrace.uTail) % FEE_TRACE_BUFFER_SIZE;
+    while( (uUsed + uLength) >= FEE_TRACE_BUFFER_SIZE )
+    {
+        uIt = Fee_tTrace.au8Buffer[Fee_tTrace.uTail] & FEE_TRACE_LENGTH_MASK;
+        Fee_tTrace.uTail = (uint16)((Fee_tTrace.uTail + uIt) % FEE_TRACE_BUFFER_SIZE);
+        uUsed -= uIt;
+        Fee_tTrace.u32Dropped++;
+    }
+
+    for( uIt = 0U; uIt < uLength; uIt++ )
+    {
+        Fee_tTrace.au8Buffer[Fee_tTrace.uHead] = aRecord[uIt];
+        Fee_tTrace.uHead = (uint16)((Fee_tTrace.uHead + 1U) % FEE_TRACE_BUFFER_SIZE);
+    }
+    Fee_tTrace.u32LastTime = uTime;
+    /* End of exclusive area. Implementation depends on integrator. */
+}
+
+/**
+* @brief        Trace the transition of Fee_eJob since the last traced job
+*
+*/
+static void Fee_TraceJob( void )
+{
+    uint8 aPayload[2U];
+
+    if( Fee_eTraceJob != Fee_eJob )
+    {
+        aPayload[0] = (uint8)Fee_eTraceJob;
+        aPayload[1] = (uint8)Fee_eJob;
+        Fee_eTraceJob = Fee_eJob;
+        Fee_TracePut( FEE_TRACE_JOB, aPayload, 2U );
+    }
+    else
+    {
+        /* No transition */
+    }
+}
+#endif
+
+#if( FEE_LATENCY_HISTOGRAM == STD_ON )
+/**
+* @brief        Log2 histogram bucket of a latency
+*
+* @param[in]    uValue      Latency
+*
+* @return       uint8       Zero for a zero latency, the number of significant
+*                           bits of uValue otherwise, saturated to the last
+*                           bucket
+*
+*/
+static uint8 Fee_LatencyBucket( uint32 uValue )
+{
+    uint8 uRetVal = 0U;
+    uint32 uRest = uValue;
+
+    while( (uRest > 0UL) && (uRetVal < (FEE_LATENCY_BUCKETS - 1U)) )
+    {
+        uRest >>= 1U;
+        uRetVal++;
+    }
+
+    return( uRetVal );
+}
+
+/**
+* @brief        Start measuring an accepted user request
+*
+* @param[in]    eApi        Service which accepted the request
+*
+*/
+static void Fee_LatencyStart( Fee_ApiType eApi )
+{
+    Fee_eLatencyApi = eApi;
+    Fee_uLatencyStart = FEE_GET_TIMESTAMP();
+    Fee_uLatencyTicks = 0UL;
+    Fee_bLatencySwap = (boolean)FALSE;
+}
+
+/**
+* @brief        Account the user request being measured once its job ended
+*
+*/
+static void Fee_LatencyEnd( void )
+{
+    Fee_LatencyHistogramType * pHistogram = NULL_PTR;
+
+    if( (FEE_API_NONE != Fee_eLatencyApi) && (MEMIF_IDLE == Fee_eModuleStatus) )
+    {
+        if( (boolean)TRUE == Fee_bLatencySwap )
         {
-            /* Immediate block - only writable if not already present in the reserved area */
-            if( (0UL == Fee_aBlockInfo[Fee_uJobBlockIndex].uDataAddr) &&
-                (0UL == Fee_aBlockInfo[Fee_uJobBlockIndex].uInvalidAddr)
-              )
-            {
-                /* The block is not written in the cluster at all => writable */
-                sRetVal = TRUE;
-            }
-            else
-            {
-                /* The block is written in the cluster - is it written in the reserved area? */
-                if( (FEE_BLOCK_OVERHEAD + uReservedSpace) >
-                    (Fee_aBlockInfo[Fee_uJobBlockIndex].uDataAddr -
-                       (Fee_aBlockInfo[Fee_uJobBlockIndex].uInvalidAddr + FEE_VIRTUAL_PAGE_SIZE)
-                    )
-                  )
-                {
-                    /* The block is already written in the reserved area */
-                    sRetVal = FALSE;
-                }
-                else
-                {
-                   /* The block is not written in the reserved area */
-                   sRetVal = TRUE;
-                }
-            }
+            pHistogram = &Fee_tLatency.atSwap[Fee_eLatencyApi];
         }
         else
         {
-            sRetVal = FALSE;
+            pHistogram = &Fee_tLatency.atDirect[Fee_eLatencyApi];
         }
+
+        pHistogram->au32Ticks[Fee_LatencyBucket( Fee_uLatencyTicks )]++;
+        pHistogram->au32Time[Fee_LatencyBucket( FEE_GET_TIMESTAMP() - Fee_uLatencyStart )]++;
+
+        Fee_eLatencyApi = FEE_API_NONE;
     }
     else
     {
-        /* Block does not target reserved area */
-        sRetVal = TRUE;
+        /* No user request measured or its job goes on */
     }
-    return sRetVal;
 }
+#endif
+
 /*==================================================================================================
 *                                       GLOBAL FUNCTIONS
 ==================================================================================================*/
@@ -2957,15 +4954,70 @@ void Fee_Init(void)
 	for( uInvalIndex = 0U; uInvalIndex < FEE_NUMBER_OF_CLUSTER_GROUPS; uInvalIndex++ )
 	{
 		Fee_aClrGrpInfo[uInvalIndex].uActClrID = 0U;
+		Fee_aClrGrpInfo[uInvalIndex].uSwapClrID = 0U;
+		Fee_aClrGrpInfo[uInvalIndex].uSwapClr = 0U;
 	}
 
 
 	/* Schedule init job */
 	Fee_eJob = FEE_JOB_INT_SCAN;
+	Fee_bJobYield = (boolean)FALSE;
+	Fee_bModePending = (boolean)FALSE;
 
 	Fee_eModuleStatus = MEMIF_BUSY_INTERNAL;
 
 	Fee_eJobResult = MEMIF_JOB_PENDING;
+#if( FEE_READ_DURING_ERASE == STD_ON )
+	Fee_bEraseReadPending = (boolean)FALSE;
+	Fee_bEraseReadLast = (boolean)FALSE;
+#endif
+}
+
+/**
+* @brief        Set the mode of the underlying flash driver.
+* @details      Switches Fls between the normal (MEMIF_MODE_SLOW) and fast
+*               (MEMIF_MODE_FAST) read and write budgets per main function call,
+*               e.g. fast mode during ignition-off or flashing sessions.
+*               During an internal management operation (MEMIF_BUSY_INTERNAL,
+*               e.g. the Fee_Init scan or a swap) the mode is forwarded as soon
+*               as no Fls job is pending, right away or by Fee_MainFunction.
+*               The request is ignored while Fee is uninitialized or busy with
+*               a user job.
+*
+* @param[in]    eMode            MEMIF_MODE_SLOW or MEMIF_MODE_FAST.
+*
+* @pre          The module must be initialized and not busy with a user job.
+* @note         The function Autosar Service ID[hex]: 0x01.
+* @note         Synchronous.
+* @note         Non Reentrant.
+*
+* @api
+*
+* @implements   Fee_SetMode_Activity
+*/
+void Fee_SetMode( MemIf_ModeType eMode )
+{
+    /* Start of exclusive area. Implementation depends on integrator. */
+
+    if( (MEMIF_IDLE == Fee_eModuleStatus) ||
+        ((MEMIF_BUSY_INTERNAL == Fee_eModuleStatus) && (MEMIF_JOB_PENDING != Fls_GetJobResult()))
+      )
+    {
+        Fee_bModePending = (boolean)FALSE;
+        Fls_SetMode( eMode );
+    }
+    else if( MEMIF_BUSY_INTERNAL == Fee_eModuleStatus )
+    {
+        /* Fls job of the internal operation pending, Fee_MainFunction forwards the mode */
+        Fee_eModePending = eMode;
+        Fee_bModePending = (boolean)TRUE;
+    }
+    else
+    {
+        /* Fee uninitialized or busy with a user job, keep the current mode */
+    }
+
+    /* End of exclusive area. Implementation depends on integrator. */
 }
 
 /**
@@ -3018,7 +5070,12 @@ Std_ReturnType Fee_Read (uint16 uBlockNumber,
     }
     else if( MEMIF_BUSY_INTERNAL == Fee_eModuleStatus )
     {
+#if( FEE_READ_DURING_ERASE == STD_ON )
+        /* Long cluster erase of the swap, serve the read in between */
+        uRetVal = Fee_ReadDuringErase( uBlockIndex, uBlockOffset, pDataBufferPtr, uLength );
+#else
         uRetVal = (Std_ReturnType)E_NOT_OK;
+#endif
     }
     else
     {
@@ -3034,9 +5091,15 @@ Std_ReturnType Fee_Read (uint16 uBlockNumber,
         Fee_eJob = FEE_JOB_READ;
 
         Fee_eModuleStatus = MEMIF_BUSY;
+#if( FEE_LATENCY_HISTOGRAM == STD_ON )
+        Fee_LatencyStart( FEE_API_READ );
+#endif
 
         /* Execute the read job */
         Fee_eJobResult = MEMIF_JOB_PENDING;
+#if( FEE_READ_DURING_ERASE == STD_ON )
+        Fee_bEraseReadLast = (boolean)FALSE;
+#endif
     }
     /* End of exclusive area. Implementation depends on integrator. */
 
@@ -3064,7 +5127,9 @@ Std_ReturnType Fee_Read (uint16 uBlockNumber,
 * @retval       E_OK             The write job was accepted by the
 *                                underlying memory driver.
 * @retval       E_NOT_OK         The write job has not been accepted by
-*                                the underlying memory driver.
+*                                the underlying memory driver, or the block
+*                                of a FEE_RECORD_COMPACT cluster group is
+*                                larger than FEE_COMPACT_DATA_SIZE.
 *
 * @pre          The module must be initialized, not busy, uBlockNumber must be
 *               valid, and pDataBufferPtr != NULL_PTR.
@@ -3100,6 +5165,14 @@ Std_ReturnType Fee_Write (uint16 uBlockNumber, const uint8 * pDataBufferPtr)
     {
         uRetVal = (Std_ReturnType)E_NOT_OK;
     }
+    else if( (0xFFFFU != uBlockIndex) &&
+             ((boolean)TRUE == Fee_IsCompactClrGrp( Fee_GetBlockClusterGrp( uBlockIndex ) )) &&
+             (Fee_GetBlockSize( uBlockIndex ) > FEE_COMPACT_DATA_SIZE)
+           )
+    {
+        /* Block data doesn't fit the compact record of its cluster group */
+        uRetVal = (Std_ReturnType)E_NOT_OK;
+    }
     else
     {
 
@@ -3110,9 +5183,15 @@ Std_ReturnType Fee_Write (uint16 uBlockNumber, const uint8 * pDataBufferPtr)
         Fee_eJob = FEE_JOB_WRITE;
 
         Fee_eModuleStatus = MEMIF_BUSY;
+#if( FEE_LATENCY_HISTOGRAM == STD_ON )
+        Fee_LatencyStart( FEE_API_WRITE );
+#endif
 
         /* Execute the write job */
         Fee_eJobResult = MEMIF_JOB_PENDING;
+#if( FEE_READ_DURING_ERASE == STD_ON )
+        Fee_bEraseReadLast = (boolean)FALSE;
+#endif
 
     }
     /* End of exclusive area. Implementation depends on integrator. */
@@ -3120,6 +5199,120 @@ Std_ReturnType Fee_Write (uint16 uBlockNumber, const uint8 * pDataBufferPtr)
     return( uRetVal );
 }
 
+/**
+* @brief        Service to cancel an ongoing job.
+* @details      Aborts the read, write, invalidate or erase immediate job and the
+*               underlying Fls job, so that a more urgent job can be requested
+*               right away. Fls completes the page program already started but
+*               doesn't start another one.
+*               A block whose header, data or flags were being programmed is left
+*               FEE_BLOCK_INCONSISTENT. Space partly programmed by a write is not
+*               reused: the next write to the cluster group swaps the cluster.
+*               A cluster swap started by a write isn't interrupted, a target
+*               cluster formatted but not validated would be taken up again by
+*               the next Fee_Init. The swap completes as internal management
+*               operation and the write ends canceled with it, without being
+*               written. Internal management operations (Fee_Init scan, swaps not
+*               started by a write) can't be canceled.
+*
+* @pre          The module must be initialized and busy with a user job.
+* @post         Changes Fee_eModuleStatus to MEMIF_IDLE and Fee_eJobResult to
+*               MEMIF_JOB_CANCELED, or during a swap Fee_eModuleStatus to
+*               MEMIF_BUSY_INTERNAL until the swap has completed.
+* @note         The function Autosar Service ID[hex]: 0x04.
+* @note         Asynchronous.
+* @note         Non Reentrant.
+*
+* @api
+*
+* @implements   Fee_Cancel_Activity
+*/
+void Fee_Cancel( void )
+{
+    uint8 uClrGrpIndex = 0U;
+    boolean bSwap = (boolean)FALSE;
+
+    /* Start of exclusive area. Implementation depends on integrator. */
+
+    if( MEMIF_BUSY == Fee_eModuleStatus )
+    {
+        switch( Fee_eJob )
+        {
+            /* Block header or data programming has started */
+            case FEE_JOB_WRITE_DATA:
+            case FEE_JOB_WRITE_UNALIGNED_DATA:
+            case FEE_JOB_WRITE_VERIFY:
+            case FEE_JOB_WRITE_VALIDATE:
+            case FEE_JOB_WRITE_DONE:
+                uClrGrpIndex = Fee_GetBlockClusterGrp(Fee_uJobBlockIndex);
+
+                /* Partly programmed space (cluster swap occurs to next write) */
+                Fee_aClrGrpInfo[uClrGrpIndex].uDataAddrIt =
+                    Fee_aClrGrpInfo[uClrGrpIndex].uHdrAddrIt +
+                    (2U * FEE_BLOCK_OVERHEAD);
+                Fee_aBlockInfo[Fee_uJobBlockIndex].eBlockStatus = FEE_BLOCK_INCONSISTENT;
+                break;
+
+            /* Invalidation flag programming has started */
+            case FEE_JOB_INVAL_BLOCK_DONE:
+                Fee_aBlockInfo[Fee_uJobBlockIndex].eBlockStatus = FEE_BLOCK_INCONSISTENT;
+                break;
+
+            /* Cluster swap started by the write, nothing programmed for the block yet */
+            case FEE_JOB_INT_SWAP_BLOCK:
+            case FEE_JOB_INT_SWAP_CLR_BLANK_CHECK:
+            case FEE_JOB_INT_SWAP_CLR_FMT:
+            case FEE_JOB_INT_SWAP_DATA_READ:
+            case FEE_JOB_INT_SWAP_DATA_WRITE:
+            case FEE_JOB_INT_SWAP_CLR_VLD_DONE:
+                bSwap = (boolean)TRUE;
+                break;
+
+            default:
+                /* Nothing programmed for the block yet, or a read job */
+                break;
+        }
+    }
+    else
+    {
+        /* Uninitialized, idle or busy with internal management operations */
+    }
+
+    if( (boolean)TRUE == bSwap )
+    {
+        /* Finish the swap, Fee_JobIntSwapClrVldDone ends the job canceled
+           instead of resuming the write */
+        Fee_eJobIntOriginalJob = FEE_JOB_DONE;
+        Fee_eModuleStatus = MEMIF_BUSY_INTERNAL;
+#if( FEE_LATENCY_HISTOGRAM == STD_ON )
+        /* Canceled requests are not measured */
+        Fee_eLatencyApi = FEE_API_NONE;
+#endif
+    }
+    else if( MEMIF_BUSY == Fee_eModuleStatus )
+    {
+        /* Set before Fls_Cancel, the Fls job error notification ignores it then */
+        Fee_eJobResult = MEMIF_JOB_CANCELED;
+        Fee_eModuleStatus = MEMIF_IDLE;
+        Fee_bJobYield = (boolean)FALSE;
+#if( FEE_LATENCY_HISTOGRAM == STD_ON )
+        /* Canceled requests are not measured */
+        Fee_eLatencyApi = FEE_API_NONE;
+#endif
+
+        Fls_Cancel();
+
+        /* Call job error notification function */
+        //FEE_NVM_JOB_ERROR_NOTIFICATION
+    }
+    else
+    {
+        /* Nothing to cancel */
+    }
+
+    /* End of exclusive area. Implementation depends on integrator. */
+}
+
 /**
 * @brief        Return the Fee module state.
 * @details      Return the Fee module state synchronously.
@@ -3170,6 +5363,18 @@ MemIf_JobResultType Fee_GetJobResult( void )
 {
     MemIf_JobResultType eRetVal = Fee_eJobResult;
 
+#if( FEE_READ_DURING_ERASE == STD_ON )
+    if( (boolean)TRUE == Fee_bEraseReadLast )
+    {
+        /* Last job was a read served during the swap erase */
+        eRetVal = Fee_eEraseReadResult;
+    }
+    else
+    {
+        /* Result of the last regular job */
+    }
+#endif
+
     return( eRetVal );
 }
 
@@ -3214,9 +5419,15 @@ Std_ReturnType Fee_InvalidateBlock(  uint16 uBlockNumber )
 		Fee_eJob = FEE_JOB_INVAL_BLOCK;
 
 		Fee_eModuleStatus = MEMIF_BUSY;
+#if( FEE_LATENCY_HISTOGRAM == STD_ON )
+		Fee_LatencyStart( FEE_API_INVALIDATE_BLOCK );
+#endif
 
 		/* Execute the invalidate block job */
 		Fee_eJobResult = MEMIF_JOB_PENDING;
+#if( FEE_READ_DURING_ERASE == STD_ON )
+		Fee_bEraseReadLast = (boolean)FALSE;
+#endif
 
 		uRetVal = (Std_ReturnType)E_OK;
 	}
@@ -3276,9 +5487,15 @@ Std_ReturnType Fee_EraseImmediateBlock(  uint16 uBlockNumber )
 	Fee_eJob = FEE_JOB_ERASE_IMMEDIATE;
 
 	Fee_eModuleStatus = MEMIF_BUSY;
+#if( FEE_LATENCY_HISTOGRAM == STD_ON )
+	Fee_LatencyStart( FEE_API_ERASE_IMMEDIATE_BLOCK );
+#endif
 
 	/* Execute the erase immediate block job */
 	Fee_eJobResult = MEMIF_JOB_PENDING;
+#if( FEE_READ_DURING_ERASE == STD_ON )
+	Fee_bEraseReadLast = (boolean)FALSE;
+#endif
 
     /* End of exclusive area. Implementation depends on integrator. */
 
@@ -3305,10 +5522,20 @@ Std_ReturnType Fee_EraseImmediateBlock(  uint16 uBlockNumber )
 */
 void Fee_JobEndNotification( void )
 {
+    FEE_HOOK_FLS_COMPLETION( (boolean)FALSE );
+
     if( MEMIF_UNINIT == Fee_eModuleStatus )
     {
 
     }
+#if( FEE_READ_DURING_ERASE == STD_ON )
+    else if( (boolean)TRUE == Fee_bEraseReadPending )
+    {
+        /* Read served during the swap erase finished, Fls has resumed the erase */
+        Fee_bEraseReadPending = (boolean)FALSE;
+        Fee_eEraseReadResult = MEMIF_JOB_OK;
+    }
+#endif
     else
     {
         if( FEE_JOB_DONE == Fee_eJob )
@@ -3331,6 +5558,9 @@ void Fee_JobEndNotification( void )
         }
         else
         {
+            /* Fresh work budget for the subsequent job steps */
+            Fee_uJobOpBudget = FEE_MAX_OPS_PER_CYCLE;
+
             Fee_eJobResult = Fee_JobSchedule();
 
             if( MEMIF_JOB_OK == Fee_eJobResult )
@@ -3369,6 +5599,9 @@ void Fee_JobEndNotification( void )
             }
         }
     }
+#if( FEE_LATENCY_HISTOGRAM == STD_ON )
+    Fee_LatencyEnd();
+#endif
 }
 
 /**
@@ -3393,10 +5626,20 @@ void Fee_JobErrorNotification( void )
 {
     uint8 uClrGrpIndex = 0U;
 
+    FEE_HOOK_FLS_COMPLETION( (MEMIF_JOB_CANCELED == Fee_eJobResult) ? (boolean)FALSE : (boolean)TRUE );
+
     if( MEMIF_UNINIT == Fee_eModuleStatus )
     {
 
     }
+#if( FEE_READ_DURING_ERASE == STD_ON )
+    else if( (boolean)TRUE == Fee_bEraseReadPending )
+    {
+        /* Read served during the swap erase failed, Fls has resumed the erase */
+        Fee_bEraseReadPending = (boolean)FALSE;
+        Fee_eEraseReadResult = MEMIF_JOB_FAILED;
+    }
+#endif
     else
     {
         if( MEMIF_JOB_CANCELED == Fee_eJobResult )
@@ -3407,6 +5650,10 @@ void Fee_JobErrorNotification( void )
         }
         else
         {
+            /* Fresh work budget for the subsequent job steps */
+            Fee_uJobOpBudget = FEE_MAX_OPS_PER_CYCLE;
+            Fee_bJobYield = (boolean)FALSE;
+
             switch( Fee_eJob )
             {
                 /* Error while reading block header. Treat block header as
@@ -3421,16 +5668,35 @@ void Fee_JobErrorNotification( void )
                     Fee_eJobResult = Fee_JobIntScanClrHdrParse( (boolean)FALSE );
                     break;
 
+                /* Error while reading block header copied by interrupted swap.
+                    Restart the swap from an erased target cluster */
+                case FEE_JOB_INT_SWAP_RESUME_HDR_PARSE:
+                    Fee_eJobResult = Fee_JobIntSwapResumeHdrParse( (boolean)FALSE );
+                    break;
+
                 /* Error while reading data from source cluster.
                     Leave block as INCONSISTENT and move on to next block */
                 case FEE_JOB_INT_SWAP_DATA_WRITE:
                     Fee_eJobResult = Fee_JobIntSwapDataWrite( (boolean)FALSE );
                     break;
+
+#if( FEE_BLANK_CHECK_BEFORE_ERASE == STD_ON )
+                /* Cluster isn't blank or the check failed.
+                    Erase the cluster before formatting it */
+                case FEE_JOB_INT_SCAN_CLR_BLANK_CHECK:
+                    Fee_eJobResult = Fee_JobIntScanClrBlankCheckDone( (boolean)FALSE );
+                    break;
+
+                case FEE_JOB_INT_SWAP_CLR_BLANK_CHECK:
+                    Fee_eJobResult = Fee_JobIntSwapClrBlankCheckDone( (boolean)FALSE );
+                    break;
+#endif
                 /* for all the following cases based on the Fee module status error notification will
                 be called */
                 case FEE_JOB_WRITE:
                 case FEE_JOB_WRITE_DATA:
                 case FEE_JOB_WRITE_UNALIGNED_DATA:
+                case FEE_JOB_WRITE_VERIFY:
                 case FEE_JOB_ERASE_IMMEDIATE:
                 case FEE_JOB_ERASE_IMMEDIATE_DONE:
                 case FEE_JOB_WRITE_VALIDATE:
@@ -3474,8 +5740,25 @@ void Fee_JobErrorNotification( void )
                     }
                     break;
             }
+#if( FEE_STATISTICS == STD_ON )
+            if( (MEMIF_JOB_PENDING == Fee_eJobResult) || (MEMIF_JOB_OK == Fee_eJobResult) )
+            {
+                /* The job went on by another path despite the flash error */
+                Fee_tStatistics.u32Retries++;
+            }
+            else
+            {
+                /* Job ended with the error */
+            }
+#endif
         }
     }
+
+    /* The error may have ended the job without a job step */
+    FEE_HOOK_JOB();
+#if( FEE_LATENCY_HISTOGRAM == STD_ON )
+    Fee_LatencyEnd();
+#endif
 }
 
 /**
@@ -3503,8 +5786,32 @@ void Fee_JobErrorNotification( void )
 */
 void Fee_MainFunction( void )
 {
+#if( FEE_LATENCY_HISTOGRAM == STD_ON )
+	if( FEE_API_NONE != Fee_eLatencyApi )
+	{
+		Fee_uLatencyTicks++;
+	}
+	else
+	{
+		/* No user request measured */
+	}
+#endif
+
+	if( ((boolean)TRUE == Fee_bModePending) && (MEMIF_JOB_PENDING != Fls_GetJobResult()) )
+	{
+		/* Mode requested during the internal management operation */
+		Fee_bModePending = (boolean)FALSE;
+		Fls_SetMode( Fee_eModePending );
+	}
+	else
+	{
+		/* No mode change waiting, or Fls still busy */
+	}
+
 	if( MEMIF_JOB_PENDING == Fee_eJobResult )
 	{
+		/* Fresh work budget for this call */
+		Fee_uJobOpBudget = FEE_MAX_OPS_PER_CYCLE;
 
 		switch( Fee_eJob )
 		{
@@ -3521,23 +5828,36 @@ void Fee_MainFunction( void )
 			  based on the job result  */
 			case FEE_JOB_WRITE_DATA:
 			case FEE_JOB_WRITE_UNALIGNED_DATA:
+			case FEE_JOB_WRITE_VERIFY:
 			case FEE_JOB_WRITE_VALIDATE:
 			case FEE_JOB_WRITE_DONE:
 			case FEE_JOB_INVAL_BLOCK_DONE:
 			case FEE_JOB_ERASE_IMMEDIATE_DONE:
 			case FEE_JOB_INT_SCAN_CLR_HDR_PARSE:
 			case FEE_JOB_INT_SCAN_CLR:
+			case FEE_JOB_INT_SCAN_CLR_BLANK_CHECK:
 			case FEE_JOB_INT_SCAN_CLR_FMT:
 			case FEE_JOB_INT_SCAN_CLR_FMT_DONE:
 			case FEE_JOB_INT_SCAN_BLOCK_HDR_PARSE:
 			case FEE_JOB_INT_SWAP_BLOCK:
+			case FEE_JOB_INT_SWAP_CLR_BLANK_CHECK:
 			case FEE_JOB_INT_SWAP_CLR_FMT:
 			case FEE_JOB_INT_SWAP_DATA_READ:
 			case FEE_JOB_INT_SWAP_DATA_WRITE:
 			case FEE_JOB_INT_SWAP_CLR_VLD_DONE:
+			case FEE_JOB_INT_SWAP_RESUME_HDR_PARSE:
 			case FEE_JOB_DONE:
 			default:
 				/* Internal or subsequent job */
+				if( (boolean)TRUE == Fee_bJobYield )
+				{
+					/* Job ran out of budget in a previous call, continue it */
+					Fee_eJobResult = Fee_JobSchedule();
+				}
+				else
+				{
+					/* Wait for Fls job end */
+				}
 				break;
 		}
 
@@ -3576,7 +5896,166 @@ void Fee_MainFunction( void )
 			}
 		}
 	}
+#if( FEE_LATENCY_HISTOGRAM == STD_ON )
+	Fee_LatencyEnd();
+#endif
+}
+
+#if( FEE_WCET_MEASUREMENT == STD_ON )
+/**
+* @brief        Return the longest measured execution time of a Fee job step
+*
+* @param[in]    eJob        Job type to report
+*
+* @return       uint32
+* @retval       Longest execution time of eJob in FEE_GET_TIMESTAMP() ticks,
+*               zero if eJob is out of range or never ran
+*
+* @note         Synchronous.
+*
+* @api
+*/
+uint32 Fee_GetJobWcet( Fee_JobType eJob )
+{
+    uint32 uRetVal = 0UL;
+
+    if( eJob <= FEE_JOB_DONE )
+    {
+        uRetVal = Fee_au32JobWcet[eJob];
+    }
+    else
+    {
+        /* Unknown job type */
+    }
+
+    return( uRetVal );
+}
+#endif
+
+#if( FEE_STATISTICS == STD_ON )
+/**
+* @brief        Take a snapshot of the job and flash request statistics
+*
+* @param[out]   pStatistics     Statistics counted since Fee_ResetStatistics
+*                               or the start up
+*
+* @note         Synchronous.
+*
+* @api
+*/
+void Fee_GetStatistics( Fee_StatisticsType * pStatistics )
+{
+    if( NULL_PTR != pStatistics )
+    {
+        /* Start of exclusive area. Implementation depends on integrator. */
+        *pStatistics = Fee_tStatistics;
+        /* End of exclusive area. Implementation depends on integrator. */
+    }
+    else
+    {
+        /* Nothing to copy to */
+    }
+}
+
+/**
+* @brief        Clear the job and flash request statistics
+*
+* @note         Synchronous.
+*
+* @api
+*/
+void Fee_ResetStatistics( void )
+{
+    static const Fee_StatisticsType tCleared = { 0 };
+
+    /* Start of exclusive area. Implementation depends on integrator. */
+    Fee_tStatistics = tCleared;
+    /* End of exclusive area. Implementation depends on integrator. */
+}
+#endif
+
+#if( FEE_TRACE == STD_ON )
+/**
+* @brief        Return the trace ring buffer
+* @details      The buffer is dumped as is, from the first byte of the
+*               Fee_TraceType structure, and decoded on the host with
+*               Fee/tools/fee_trace.py.
+*
+* @return       const Fee_TraceType *   Trace ring buffer
+*
+* @note         Synchronous.
+*
+* @api
+*/
+const Fee_TraceType * Fee_GetTrace( void )
+{
+    return( &Fee_tTrace );
+}
+
+/**
+* @brief        Drop all records of the trace ring buffer
+*
+* @note         Synchronous.
+*
+* @api
+*/
+void Fee_ResetTrace( void )
+{
+    /* Start of exclusive area. Implementation depends on integrator. */
+    Fee_tTrace.u32Dropped = 0UL;
+    Fee_tTrace.uHead = 0U;
+    Fee_tTrace.uTail = 0U;
+    /* End of exclusive area. Implementation depends on integrator. */
+}
+#endif
+
+#if( FEE_LATENCY_HISTOGRAM == STD_ON )
+/**
+* @brief        Take a snapshot of the latency histograms of the user requests
+* @details      A request is measured from its acceptance by Fee_Read,
+*               Fee_Write, Fee_InvalidateBlock or Fee_EraseImmediateBlock to
+*               the end of its job, in Fee_MainFunction calls and in
+*               FEE_GET_TIMESTAMP() ticks. Requests which waited for a cluster
+*               swap are counted apart. Canceled requests and reads served
+*               during the swap erase are not measured.
+*
+* @param[out]   pLatency        Histograms counted since Fee_ResetLatency or
+*                               the start up
+*
+* @note         Synchronous.
+*
+* @api
+*/
+void Fee_GetLatency( Fee_LatencyType * pLatency )
+{
+    if( NULL_PTR != pLatency )
+    {
+        /* Start of exclusive area. Implementation depends on integrator. */
+        *pLatency = Fee_tLatency;
+        /* End of exclusive area. Implementation depends on integrator. */
+    }
+    else
+    {
+        /* Nothing to copy to */
+    }
+}
+
+/**
+* @brief        Clear the latency histograms of the user requests
+*
+* @note         Synchronous.
+*
+* @api
+*/
+void Fee_ResetLatency( void )
+{
+    static const Fee_LatencyType tCleared = { 0 };
+
+    /* Start of exclusive area. Implementation depends on integrator. */
+    Fee_tLatency = tCleared;
+    /* End of exclusive area. Implementation depends on integrator. */
 }
+#endif
 
 #ifdef __cplusplus
 }
@@ -21,7 +21,8 @@ static const Fee_ClusterType Fee_FeeClusterGroup_0[2] =
      {
          Fee_FeeClusterGroup_0, 
          2U, 
-         256U 
+         256U, 
+         FEE_RECORD_STANDARD 
      }
  };
 
@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+"""Decode a Fee trace ring buffer dump (FEE_TRACE == STD_ON).
+
+The dump is the raw Fee_TraceType structure returned by Fee_GetTrace(),
+for example saved by the debugger from the address of Fee_tTrace with the
+size of the structure. The tool prints the timeline of the recorded events
+and the time spent per Fee job, per flash request type and per swap.
+
+Usage: fee_trace.py [--big-endian] [--tick TICK] [--header FILE] DUMP
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+TRACE_MAGIC = 0x54656546
+TYPE_SHIFT = 5
+LENGTH_MASK = 0x1F
+
+TRACE_JOB = 1
+TRACE_FLS_REQUEST = 2
+TRACE_FLS_COMPLETION = 3
+TRACE_SWAP_START = 4
+TRACE_SWAP_END = 5
+
+FLS_REQUESTS = ["READ", "WRITE", "ERASE", "COMPARE", "BLANK_CHECK"]
+
+
+def load_job_names(header):
+    """Return the Fee_JobType enumerator names in value order."""
+    with open(header) as f:
+        text = f.read()
+    match = re.search(r"typedef\s+enum\s*\{([^{}]*)\}\s*Fee_JobType\s*;", text, re.S)
+    if match is None:
+        raise SystemExit("Fee_JobType not found in %s" % header)
+    body = re.sub(r"/\*.*?\*/", "", match.group(1), flags=re.S)
+    return [name.split("=")[0].strip() for name in body.split(",") if name.strip()]
+
+
+def get_varint(record, index):
+    value = 0
+    shift = 0
+    while True:
+        byte = record[index]
+        index += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if byte < 0x80:
+            return value, index
+
+
+def read_records(dump, big_endian):
+    """Return (records, dropped); a record is (delta, type, payload bytes)."""
+    endian = ">" if big_endian else "<"
+    magic, last_time, dropped, head, tail = struct.unpack_from(endian + "IIIHH", dump)
+    if magic != TRACE_MAGIC:
+        raise SystemExit("not a Fee trace dump (magic 0x%08X)" % magic)
+    buffer = dump[struct.calcsize(endian + "IIIHH"):]
+    size = len(buffer)
+    if head >= size or tail >= size:
+        raise SystemExit("head %d or tail %d outside the %d byte buffer" % (head, tail, size))
+
+    records = []
+    index = tail
+    while index != head:
+        length = buffer[index] & LENGTH_MASK
+        if length < 2:
+            raise SystemExit("corrupt record at offset %d" % index)
+        record = bytes(buffer[(index + i) % size] for i in range(length))
+        delta, start = get_varint(record, 1)
+        records.append((delta, record[0] >> TYPE_SHIFT, record[start:]))
+        index = (index + length) % size
+
+    # Deltas are relative to the previous record, anchor them to the newest one
+    timed = []
+    time = last_time
+    for delta, rtype, payload in reversed(records):
+        timed.append((time, rtype, payload))
+        time -= delta
+    timed.reverse()
+    return timed, dropped
+
+
+def job_name(jobs, value):
+    return jobs[value] if value < len(jobs) else "FEE_JOB_%d" % value
+
+
+def describe(jobs, rtype, payload):
+    if rtype == TRACE_JOB:
+        return "job      %s -> %s" % (job_name(jobs, payload[0]), job_name(jobs, payload[1]))
+    if rtype == TRACE_FLS_REQUEST:
+        address, index = get_varint(payload, 1)
+        length, _ = get_varint(payload, index)
+        return "fls      %-11s 0x%08X %6d bytes" % (FLS_REQUESTS[payload[0]], address, length)
+    if rtype == TRACE_FLS_COMPLETION:
+        return "fls      done, %s" % ("failed" if payload[0] else "ok")
+    if rtype == TRACE_SWAP_START:
+        return "swap     start, cluster group %d" % payload[0]
+    if rtype == TRACE_SWAP_END:
+        return "swap     end, cluster group %d now on cluster %d" % (payload[0], payload[1])
+    return "unknown record type %d" % rtype
+
+
+class Latency:
+    def __init__(self):
+        self.count = 0
+        self.total = 0
+        self.max = 0
+        self.errors = 0
+        self.bytes = 0
+
+    def add(self, duration):
+        self.count += 1
+        self.total += duration
+        self.max = max(self.max, duration)
+
+
+def print_table(title, rows, tick, extra=None):
+    if not rows:
+        return
+    print()
+    print("%-34s %7s %12s %12s %12s%s" % (title, "count", "total", "mean", "max",
+                                          "" if extra is None else " %10s" % extra[0]))
+    for name, lat in rows:
+        line = "%-34s %7d %12.1f %12.1f %12.1f" % (
+            name, lat.count, lat.total * tick, lat.total * tick / lat.count, lat.max * tick)
+        if extra is not None:
+            line += " %10s" % extra[1](lat)
+        print(line)
+
+
+def main():
+    tools = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("dump", help="raw dump of the Fee_TraceType structure")
+    parser.add_argument("--big-endian", action="store_true", help="dump of a big endian target")
+    parser.add_argument("--tick", type=float, default=1.0,
+                        help="duration of a FEE_GET_TIMESTAMP() tick in the printed unit")
+    parser.add_argument("--header", default=os.path.join(tools, "..", "include", "Fee_InternalTypes.h"),
+                        help="Fee_InternalTypes.h declaring Fee_JobType")
+    args = parser.parse_args()
+
+    jobs = load_job_names(args.header)
+    with open(args.dump, "rb") as f:
+        records, dropped = read_records(f.read(), args.big_endian)
+    if not records:
+        print("no records")
+        return 0
+
+    start = records[0][0]
+    print("%d records, %d older records dropped" % (len(records), dropped))
+    print()
+    previous = start
+    for time, rtype, payload in records:
+        print("%12.1f %+10.1f  %s" % ((time - start) * args.tick, (time - previous) * args.tick,
+                                      describe(jobs, rtype, payload)))
+        previous = time
+
+    # Per-phase breakdown: a job lasts from its transition in to the next
+    # transition, a flash request from the request to its completion
+    per_job = {}
+    per_fls = {}
+    swaps = Latency()
+    job = None
+    job_start = 0
+    fls = None
+    swap_start = None
+    for time, rtype, payload in records:
+        if rtype == TRACE_JOB:
+            if job is not None:
+                per_job.setdefault(job, Latency()).add(time - job_start)
+            job, job_start = payload[1], time
+        elif rtype == TRACE_FLS_REQUEST:
+            _, index = get_varint(payload, 1)
+            length, _ = get_varint(payload, index)
+            fls = (payload[0], time, length)
+        elif rtype == TRACE_FLS_COMPLETION and fls is not None:
+            lat = per_fls.setdefault(fls[0], Latency())
+            lat.add(time - fls[1])
+            lat.bytes += fls[2]
+            lat.errors += payload[0]
+            fls = None
+        elif rtype == TRACE_SWAP_START:
+            swap_start = time
+        elif rtype == TRACE_SWAP_END and swap_start is not None:
+            swaps.add(time - swap_start)
+            swap_start = None
+
+    print_table("job", [(job_name(jobs, j), per_job[j]) for j in sorted(per_job)], args.tick)
+    print_table("flash request", [(FLS_REQUESTS[t], per_fls[t]) for t in sorted(per_fls)], args.tick,
+                ("bytes/err", lambda lat: "%d/%d" % (lat.bytes, lat.errors)))
+    print_table("swap", [("cluster swap", swaps)] if swaps.count else [], args.tick)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
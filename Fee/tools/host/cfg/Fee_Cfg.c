@@ -0,0 +1,178 @@
+#include "Fee.h"
+
+/*
+ * Host configuration of the Fee/tools/host builds: cluster group 0 holds blocks of
+ * 4 to 128 bytes in standard records, cluster group 1 small blocks in compact records.
+ */
+
+static const Fee_ClusterType Fee_FeeClusterGroup_0[2] =
+ {
+     {
+         0U,
+         6144U
+     },
+     {
+         6144U,
+         6144U
+     }
+ };
+
+static const Fee_ClusterType Fee_FeeClusterGroup_1[2] =
+ {
+     {
+         12288U,
+         2048U
+     },
+     {
+         14336U,
+         2048U
+     }
+ };
+
+  const Fee_ClusterGroupType Fee_ClrGrps[FEE_NUMBER_OF_CLUSTER_GROUPS] =
+ {
+     {
+         Fee_FeeClusterGroup_0,
+         2U,
+         256U,
+         FEE_RECORD_STANDARD
+     },
+     {
+         Fee_FeeClusterGroup_1,
+         2U,
+         64U,
+         FEE_RECORD_COMPACT
+     }
+ };
+
+ const Fee_BlockConfigType Fee_BlockConfig[FEE_CRT_CFG_NR_OF_BLOCKS] =
+{
+    {
+        "HOST1",
+        1,
+        4U,
+        0U,
+        (boolean)FALSE,
+        FEE_PROJECT_RESERVED
+    },
+    {
+        "HOST2",
+        2,
+        8U,
+        0U,
+        (boolean)TRUE,
+        FEE_PROJECT_RESERVED
+    },
+    {
+        "HOST3",
+        3,
+        8U,
+        0U,
+        (boolean)FALSE,
+        FEE_PROJECT_RESERVED
+    },
+    {
+        "HOST4",
+        4,
+        16U,
+        0U,
+        (boolean)FALSE,
+        FEE_PROJECT_RESERVED
+    },
+    {
+        "HOST5",
+        5,
+        16U,
+        0U,
+        (boolean)FALSE,
+        FEE_PROJECT_RESERVED
+    },
+    {
+        "HOST6",
+        6,
+        16U,
+        0U,
+        (boolean)FALSE,
+        FEE_PROJECT_RESERVED
+    },
+    {
+        "HOST7",
+        7,
+        32U,
+        0U,
+        (boolean)FALSE,
+        FEE_PROJECT_RESERVED
+    },
+    {
+        "HOST8",
+        8,
+        32U,
+        0U,
+        (boolean)FALSE,
+        FEE_PROJECT_RESERVED
+    },
+    {
+        "HOST9",
+        9,
+        64U,
+        0U,
+        (boolean)FALSE,
+        FEE_PROJECT_RESERVED
+    },
+    {
+        "HOST10",
+        10,
+        64U,
+        0U,
+        (boolean)FALSE,
+        FEE_PROJECT_RESERVED
+    },
+    {
+        "HOST11",
+        11,
+        128U,
+        0U,
+        (boolean)TRUE,
+        FEE_PROJECT_RESERVED
+    },
+    {
+        "HOST12",
+        12,
+        128U,
+        0U,
+        (boolean)FALSE,
+        FEE_PROJECT_RESERVED
+    },
+    {
+        "HOST13",
+        13,
+        4U,
+        1U,
+        (boolean)TRUE,
+        FEE_PROJECT_RESERVED
+    },
+    {
+        "HOST14",
+        14,
+        4U,
+        1U,
+        (boolean)FALSE,
+        FEE_PROJECT_RESERVED
+    },
+    {
+        "HOST15",
+        15,
+        8U,
+        1U,
+        (boolean)FALSE,
+        FEE_PROJECT_RESERVED
+    },
+    {
+        "HOST16",
+        16,
+        12U,
+        1U,
+        (boolean)FALSE,
+        FEE_PROJECT_RESERVED
+    }
+};
@@ -0,0 +1,298 @@
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Fls_Cfg.h"
+#include "Fls_Flash.h"
+#include "Fls_Sim.h"
+
+/*
+ * Host configuration of the Fee/tools/host builds: 16 sectors of 1 KiB served by
+ * the host flash model, page size 8.
+ */
+
+extern void Fee_JobEndNotification( void );
+
+extern void Fee_JobErrorNotification( void );
+
+/* Mode flags of every sector, the irq variant of the Makefile overrides them */
+#ifndef FLS_HOST_SECTOR_FLAGS
+#define FLS_HOST_SECTOR_FLAGS   FLS_SECTOR_ERASE_ASYNCH
+#endif
+
+/* aFlsSectorFlags[] (FlsConfigSet) */
+static const uint8 FlsConfigSet_aFlsSectorFlags[16] =
+{
+    FLS_HOST_SECTOR_FLAGS, /* (FlsSector_0) */
+    FLS_HOST_SECTOR_FLAGS, /* (FlsSector_1) */
+    FLS_HOST_SECTOR_FLAGS, /* (FlsSector_2) */
+    FLS_HOST_SECTOR_FLAGS, /* (FlsSector_3) */
+    FLS_HOST_SECTOR_FLAGS, /* (FlsSector_4) */
+    FLS_HOST_SECTOR_FLAGS, /* (FlsSector_5) */
+    FLS_HOST_SECTOR_FLAGS, /* (FlsSector_6) */
+    FLS_HOST_SECTOR_FLAGS, /* (FlsSector_7) */
+    FLS_HOST_SECTOR_FLAGS, /* (FlsSector_8) */
+    FLS_HOST_SECTOR_FLAGS, /* (FlsSector_9) */
+    FLS_HOST_SECTOR_FLAGS, /* (FlsSector_10) */
+    FLS_HOST_SECTOR_FLAGS, /* (FlsSector_11) */
+    FLS_HOST_SECTOR_FLAGS, /* (FlsSector_12) */
+    FLS_HOST_SECTOR_FLAGS, /* (FlsSector_13) */
+    FLS_HOST_SECTOR_FLAGS, /* (FlsSector_14) */
+    FLS_HOST_SECTOR_FLAGS /* (FlsSector_15) */
+};
+/* aFlsSectorUnlock[] (FlsConfigSet) */
+static const uint8 FlsConfigSet_aFlsSectorUnlock[16] =
+{
+    1U, /* (FlsSector_0) */
+    1U, /* (FlsSector_1) */
+    1U, /* (FlsSector_2) */
+    1U, /* (FlsSector_3) */
+    1U, /* (FlsSector_4) */
+    1U, /* (FlsSector_5) */
+    1U, /* (FlsSector_6) */
+    1U, /* (FlsSector_7) */
+    1U, /* (FlsSector_8) */
+    1U, /* (FlsSector_9) */
+    1U, /* (FlsSector_10) */
+    1U, /* (FlsSector_11) */
+    1U, /* (FlsSector_12) */
+    1U, /* (FlsSector_13) */
+    1U, /* (FlsSector_14) */
+    1U /* (FlsSector_15) */
+};
+
+/* aFlsSectorEndAddr[] (FlsConfigSet) */
+static const Fls_AddressType FlsConfigSet_aFlsSectorEndAddr[16] =
+{
+    (Fls_AddressType)1023U, /* FlsSectorEndAddr (FlsSector_0)*/
+    (Fls_AddressType)2047U, /* FlsSectorEndAddr (FlsSector_1)*/
+    (Fls_AddressType)3071U, /* FlsSectorEndAddr (FlsSector_2)*/
+    (Fls_AddressType)4095U, /* FlsSectorEndAddr (FlsSector_3)*/
+    (Fls_AddressType)5119U, /* FlsSectorEndAddr (FlsSector_4)*/
+    (Fls_AddressType)6143U, /* FlsSectorEndAddr (FlsSector_5)*/
+    (Fls_AddressType)7167U, /* FlsSectorEndAddr (FlsSector_6)*/
+    (Fls_AddressType)8191U, /* FlsSectorEndAddr (FlsSector_7)*/
+    (Fls_AddressType)9215U, /* FlsSectorEndAddr (FlsSector_8)*/
+    (Fls_AddressType)10239U, /* FlsSectorEndAddr (FlsSector_9)*/
+    (Fls_AddressType)11263U, /* FlsSectorEndAddr (FlsSector_10)*/
+    (Fls_AddressType)12287U, /* FlsSectorEndAddr (FlsSector_11)*/
+    (Fls_AddressType)13311U, /* FlsSectorEndAddr (FlsSector_12)*/
+    (Fls_AddressType)14335U, /* FlsSectorEndAddr (FlsSector_13)*/
+    (Fls_AddressType)15359U, /* FlsSectorEndAddr (FlsSector_14)*/
+    (Fls_AddressType)16383U /* FlsSectorEndAddr (FlsSector_15)*/
+};
+
+/* aFlsSectorSize[] (FlsConfigSet) */
+static const Fls_AddressType FlsConfigSet_aFlsSectorSize[16] =
+{
+    (Fls_AddressType)1024U, /* FlsSectorSize (FlsSector_0)*/
+    (Fls_AddressType)1024U, /* FlsSectorSize (FlsSector_1)*/
+    (Fls_AddressType)1024U, /* FlsSectorSize (FlsSector_2)*/
+    (Fls_AddressType)1024U, /* FlsSectorSize (FlsSector_3)*/
+    (Fls_AddressType)1024U, /* FlsSectorSize (FlsSector_4)*/
+    (Fls_AddressType)1024U, /* FlsSectorSize (FlsSector_5)*/
+    (Fls_AddressType)1024U, /* FlsSectorSize (FlsSector_6)*/
+    (Fls_AddressType)1024U, /* FlsSectorSize (FlsSector_7)*/
+    (Fls_AddressType)1024U, /* FlsSectorSize (FlsSector_8)*/
+    (Fls_AddressType)1024U, /* FlsSectorSize (FlsSector_9)*/
+    (Fls_AddressType)1024U, /* FlsSectorSize (FlsSector_10)*/
+    (Fls_AddressType)1024U, /* FlsSectorSize (FlsSector_11)*/
+    (Fls_AddressType)1024U, /* FlsSectorSize (FlsSector_12)*/
+    (Fls_AddressType)1024U, /* FlsSectorSize (FlsSector_13)*/
+    (Fls_AddressType)1024U, /* FlsSectorSize (FlsSector_14)*/
+    (Fls_AddressType)1024U /* FlsSectorSize (FlsSector_15)*/
+};
+
+/* FlsNumberOfSector[] (FlsConfigSet) */
+static const uint16 FlsConfigSet_aFlsNumberOfSector[16] =
+{
+    1U, /* FlsNumberOfSector (FlsSector_0)*/
+    1U, /* FlsNumberOfSector (FlsSector_1)*/
+    1U, /* FlsNumberOfSector (FlsSector_2)*/
+    1U, /* FlsNumberOfSector (FlsSector_3)*/
+    1U, /* FlsNumberOfSector (FlsSector_4)*/
+    1U, /* FlsNumberOfSector (FlsSector_5)*/
+    1U, /* FlsNumberOfSector (FlsSector_6)*/
+    1U, /* FlsNumberOfSector (FlsSector_7)*/
+    1U, /* FlsNumberOfSector (FlsSector_8)*/
+    1U, /* FlsNumberOfSector (FlsSector_9)*/
+    1U, /* FlsNumberOfSector (FlsSector_10)*/
+    1U, /* FlsNumberOfSector (FlsSector_11)*/
+    1U, /* FlsNumberOfSector (FlsSector_12)*/
+    1U, /* FlsNumberOfSector (FlsSector_13)*/
+    1U, /* FlsNumberOfSector (FlsSector_14)*/
+    1U /* FlsNumberOfSector (FlsSector_15)*/
+};
+
+/* aFlsSectorStartAddr[] (FlsConfigSet) */
+static const Fls_AddressType FlsConfigSet_aFlsSectorStartAddr[16] =
+{
+    (Fls_AddressType)0U, /* FlsSectorStartAddr (FlsSector_0)*/
+    (Fls_AddressType)1024U, /* FlsSectorStartAddr (FlsSector_1)*/
+    (Fls_AddressType)2048U, /* FlsSectorStartAddr (FlsSector_2)*/
+    (Fls_AddressType)3072U, /* FlsSectorStartAddr (FlsSector_3)*/
+    (Fls_AddressType)4096U, /* FlsSectorStartAddr (FlsSector_4)*/
+    (Fls_AddressType)5120U, /* FlsSectorStartAddr (FlsSector_5)*/
+    (Fls_AddressType)6144U, /* FlsSectorStartAddr (FlsSector_6)*/
+    (Fls_AddressType)7168U, /* FlsSectorStartAddr (FlsSector_7)*/
+    (Fls_AddressType)8192U, /* FlsSectorStartAddr (FlsSector_8)*/
+    (Fls_AddressType)9216U, /* FlsSectorStartAddr (FlsSector_9)*/
+    (Fls_AddressType)10240U, /* FlsSectorStartAddr (FlsSector_10)*/
+    (Fls_AddressType)11264U, /* FlsSectorStartAddr (FlsSector_11)*/
+    (Fls_AddressType)12288U, /* FlsSectorStartAddr (FlsSector_12)*/
+    (Fls_AddressType)13312U, /* FlsSectorStartAddr (FlsSector_13)*/
+    (Fls_AddressType)14336U, /* FlsSectorStartAddr (FlsSector_14)*/
+    (Fls_AddressType)15360U /* FlsSectorStartAddr (FlsSector_15)*/
+};
+
+/* paSectorProgSize[] (FlsConfigSet) */
+static const Fls_LengthType FlsConfigSet_aFlsProgSize[16] =
+{
+    (Fls_LengthType)FLS_WRITE_DOUBLE_WORD, /* FlsProgrammingSize (FlsSector_0) */
+    (Fls_LengthType)FLS_WRITE_DOUBLE_WORD, /* FlsProgrammingSize (FlsSector_1) */
+    (Fls_LengthType)FLS_WRITE_DOUBLE_WORD, /* FlsProgrammingSize (FlsSector_2) */
+    (Fls_LengthType)FLS_WRITE_DOUBLE_WORD, /* FlsProgrammingSize (FlsSector_3) */
+    (Fls_LengthType)FLS_WRITE_DOUBLE_WORD, /* FlsProgrammingSize (FlsSector_4) */
+    (Fls_LengthType)FLS_WRITE_DOUBLE_WORD, /* FlsProgrammingSize (FlsSector_5) */
+    (Fls_LengthType)FLS_WRITE_DOUBLE_WORD, /* FlsProgrammingSize (FlsSector_6) */
+    (Fls_LengthType)FLS_WRITE_DOUBLE_WORD, /* FlsProgrammingSize (FlsSector_7) */
+    (Fls_LengthType)FLS_WRITE_DOUBLE_WORD, /* FlsProgrammingSize (FlsSector_8) */
+    (Fls_LengthType)FLS_WRITE_DOUBLE_WORD, /* FlsProgrammingSize (FlsSector_9) */
+    (Fls_LengthType)FLS_WRITE_DOUBLE_WORD, /* FlsProgrammingSize (FlsSector_10) */
+    (Fls_LengthType)FLS_WRITE_DOUBLE_WORD, /* FlsProgrammingSize (FlsSector_11) */
+    (Fls_LengthType)FLS_WRITE_DOUBLE_WORD, /* FlsProgrammingSize (FlsSector_12) */
+    (Fls_LengthType)FLS_WRITE_DOUBLE_WORD, /* FlsProgrammingSize (FlsSector_13) */
+    (Fls_LengthType)FLS_WRITE_DOUBLE_WORD, /* FlsProgrammingSize (FlsSector_14) */
+    (Fls_LengthType)FLS_WRITE_DOUBLE_WORD /* FlsProgrammingSize (FlsSector_15) */
+};
+
+/* paSectorPageSize[] (FlsConfigSet) */
+static const Fls_LengthType FlsConfigSet_aFlsSectorPageSize[16] =
+{
+    (Fls_LengthType)8U, /* FlsPageSize (FlsSector_0) */
+    (Fls_LengthType)8U, /* FlsPageSize (FlsSector_1) */
+    (Fls_LengthType)8U, /* FlsPageSize (FlsSector_2) */
+    (Fls_LengthType)8U, /* FlsPageSize (FlsSector_3) */
+    (Fls_LengthType)8U, /* FlsPageSize (FlsSector_4) */
+    (Fls_LengthType)8U, /* FlsPageSize (FlsSector_5) */
+    (Fls_LengthType)8U, /* FlsPageSize (FlsSector_6) */
+    (Fls_LengthType)8U, /* FlsPageSize (FlsSector_7) */
+    (Fls_LengthType)8U, /* FlsPageSize (FlsSector_8) */
+    (Fls_LengthType)8U, /* FlsPageSize (FlsSector_9) */
+    (Fls_LengthType)8U, /* FlsPageSize (FlsSector_10) */
+    (Fls_LengthType)8U, /* FlsPageSize (FlsSector_11) */
+    (Fls_LengthType)8U, /* FlsPageSize (FlsSector_12) */
+    (Fls_LengthType)8U, /* FlsPageSize (FlsSector_13) */
+    (Fls_LengthType)8U, /* FlsPageSize (FlsSector_14) */
+    (Fls_LengthType)8U /* FlsPageSize (FlsSector_15) */
+};
+
+/* The host flash model doesn't access the sectors through their addresses */
+static const Fls_Flash_InternalSectorInfoType FlsConfigSet_aSectorInfo[16] =
+{
+    { (volatile uint32_t*)(D_FLASH_BASE_ADDR + 0x000000UL), 0U },
+    { (volatile uint32_t*)(D_FLASH_BASE_ADDR + 0x000400UL), 1U },
+    { (volatile uint32_t*)(D_FLASH_BASE_ADDR + 0x000800UL), 2U },
+    { (volatile uint32_t*)(D_FLASH_BASE_ADDR + 0x000C00UL), 3U },
+    { (volatile uint32_t*)(D_FLASH_BASE_ADDR + 0x001000UL), 4U },
+    { (volatile uint32_t*)(D_FLASH_BASE_ADDR + 0x001400UL), 5U },
+    { (volatile uint32_t*)(D_FLASH_BASE_ADDR + 0x001800UL), 6U },
+    { (volatile uint32_t*)(D_FLASH_BASE_ADDR + 0x001C00UL), 7U },
+    { (volatile uint32_t*)(D_FLASH_BASE_ADDR + 0x002000UL), 8U },
+    { (volatile uint32_t*)(D_FLASH_BASE_ADDR + 0x002400UL), 9U },
+    { (volatile uint32_t*)(D_FLASH_BASE_ADDR + 0x002800UL), 10U },
+    { (volatile uint32_t*)(D_FLASH_BASE_ADDR + 0x002C00UL), 11U },
+    { (volatile uint32_t*)(D_FLASH_BASE_ADDR + 0x003000UL), 12U },
+    { (volatile uint32_t*)(D_FLASH_BASE_ADDR + 0x003400UL), 13U },
+    { (volatile uint32_t*)(D_FLASH_BASE_ADDR + 0x003800UL), 14U },
+    { (volatile uint32_t*)(D_FLASH_BASE_ADDR + 0x003C00UL), 15U }
+};
+
+/*  FLASH physical sectorization description */
+static const Fls_Flash_InternalSectorInfoType * const FlsConfigSet_aSectorList[16] =
+{
+    &FlsConfigSet_aSectorInfo[0],
+    &FlsConfigSet_aSectorInfo[1],
+    &FlsConfigSet_aSectorInfo[2],
+    &FlsConfigSet_aSectorInfo[3],
+    &FlsConfigSet_aSectorInfo[4],
+    &FlsConfigSet_aSectorInfo[5],
+    &FlsConfigSet_aSectorInfo[6],
+    &FlsConfigSet_aSectorInfo[7],
+    &FlsConfigSet_aSectorInfo[8],
+    &FlsConfigSet_aSectorInfo[9],
+    &FlsConfigSet_aSectorInfo[10],
+    &FlsConfigSet_aSectorInfo[11],
+    &FlsConfigSet_aSectorInfo[12],
+    &FlsConfigSet_aSectorInfo[13],
+    &FlsConfigSet_aSectorInfo[14],
+    &FlsConfigSet_aSectorInfo[15]
+};
+
+/* aFlsSectorRuns[] (FlsConfigSet): geometry descriptor, runs of equal sized sectors */
+static const Fls_SectorRunType FlsConfigSet_aFlsSectorRuns[1] =
+{
+    /* FlsSector_0 .. FlsSector_15, 1024 bytes each */
+    { (Fls_AddressType)0U, (Fls_AddressType)16383U, 0U, 10U }
+};
+
+/* paHwCh[] (FlsConfigSet) */
+static const Fls_HwChType FlsConfigSet_paHwCh[16] =
+{
+    FLS_CH_SIM, /* (FlsSector_0) */
+    FLS_CH_SIM, /* (FlsSector_1) */
+    FLS_CH_SIM, /* (FlsSector_2) */
+    FLS_CH_SIM, /* (FlsSector_3) */
+    FLS_CH_SIM, /* (FlsSector_4) */
+    FLS_CH_SIM, /* (FlsSector_5) */
+    FLS_CH_SIM, /* (FlsSector_6) */
+    FLS_CH_SIM, /* (FlsSector_7) */
+    FLS_CH_SIM, /* (FlsSector_8) */
+    FLS_CH_SIM, /* (FlsSector_9) */
+    FLS_CH_SIM, /* (FlsSector_10) */
+    FLS_CH_SIM, /* (FlsSector_11) */
+    FLS_CH_SIM, /* (FlsSector_12) */
+    FLS_CH_SIM, /* (FlsSector_13) */
+    FLS_CH_SIM, /* (FlsSector_14) */
+    FLS_CH_SIM /* (FlsSector_15) */
+};
+
+/* paChannelOps[] (FlsConfigSet) */
+static const Fls_ChannelOpsType * const FlsConfigSet_aChannelOps[FLS_HW_CH_COUNT] =
+{
+    NULL_PTR, /* FLS_CH_INTERN, not built on the host */
+    NULL_PTR, /* FLS_CH_QSPI, no sector configured */
+    &Fls_Sim_tChannelOps /* FLS_CH_SIM */
+};
+
+/* Fls module initialization data (FlsConfigSet)*/
+const Fls_ConfigType Fls_Config=
+{
+    &Fee_JobEndNotification, /* FlsJobEndNotification */
+    &Fee_JobErrorNotification, /* FlsJobErrorNotification */
+    NULL_PTR, /* FlsStartFlashAccessNotif */
+    NULL_PTR, /* FlsFinishedFlashAccessNotif */
+    MEMIF_MODE_SLOW, /* FlsDefaultMode */
+    1048576U, /* FlsMaxReadFastMode */
+    1024U, /* FlsMaxReadNormalMode */
+    256U, /* FlsMaxWriteFastMode */
+    32U, /* FlsMaxWriteNormalMode */
+    16U, /* FlsSectorCount */
+    &FlsConfigSet_aFlsSectorEndAddr,                /* (*paSectorEndAddr)[]  */
+    &FlsConfigSet_aFlsSectorStartAddr,              /* (*paSectorStartAddr)[]  */
+    &FlsConfigSet_aFlsSectorSize,                   /* (*paSectorSize)[]  */
+    &FlsConfigSet_aFlsNumberOfSector,               /* (*paNumberOfSector)[]  */
+    &FlsConfigSet_aSectorList,                      /* (*pSectorList)[] */
+    &FlsConfigSet_aFlsSectorFlags,                  /* (*paSectorFlags)[] */
+    &FlsConfigSet_aFlsProgSize,                     /* (*paSectorProgSize)[] */
+    &FlsConfigSet_aFlsSectorPageSize,               /* (*paSectorPageSize)[] */
+    &FlsConfigSet_aFlsSectorUnlock,                 /* (*paSectorUnlock)[] */
+    &FlsConfigSet_paHwCh,                           /* (*paHwCh)[] */
+    &FlsConfigSet_aChannelOps,                      /* (*paChannelOps)[] */
+    NULL_PTR, /* pFlsQspiCfgConfig */
+    1U, /* FlsSectorRunCount */
+    &FlsConfigSet_aFlsSectorRuns,                   /* (*paSectorRuns)[] */
+    0U /* configCrc */
+};
@@ -0,0 +1,912 @@
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fee_host.h"
+
+/*
+ * Fee benchmark on the host flash model. Every workload starts on an erased flash
+ * image and prints one JSON object per line:
+ *
+ *   workload       name of the workload
+ *   ops            Fee requests served
+ *   ops_per_s      requests per second of virtual (flash) time
+ *   host_ops_per_s requests per second of host time, the cost of the Fee/Fls code
+ *   ticks_per_op   Fee_MainFunction/Fls_MainFunction ticks per request
+ *   lat_p50/p99/max latency of a request in ticks, from its acceptance until
+ *                  Fee is idle again
+ *   user_bytes     data bytes of the write requests
+ *   prog_bytes     bytes programmed on the flash
+ *   write_amp      prog_bytes per user byte
+ *   read_bytes     bytes read, compared and blank checked on the flash
+ *   erases, swaps  sector erases and cluster swaps
+ *   fee_latency    Fee_GetLatency histograms per service, the log2 buckets of
+ *                  the requests served directly and of those which waited for
+ *                  a cluster swap, in ticks and in virtual us. Trailing empty
+ *                  buckets are left out, services without requests too.
+ *
+ * The cold_init workloads fill cluster group 0 to the given level and time the
+ * Fee_Init cluster scan instead, their ops is 1.
+ *
+ * The read_during_swap workload prints its own metrics: read_during_erase, the
+ * FEE_READ_DURING_ERASE switch of the build, reads, served_in_erase the reads Fee
+ * accepted while the swap erased, lat_p50/max in ticks and lat_p50_us/max_us in
+ * virtual us of a Fee_Read retried from a random point of the swap erase, and
+ * erase_suspends of the flash model.
+ *
+ * The erase_time workload prints the Fls_Erase time of a cluster of group 0 and of
+ * the whole flash, a bank of the model, in ticks and virtual us, with block_erase
+ * the FLS_BLOCK_ERASE switch of the build.
+ *
+ * With a trace file, the Fee_GetTrace ring buffer at the end of the write_storm
+ * workload is written to it as a raw Fee_TraceType dump for Fee/tools/fee_trace.py.
+ *
+ * Usage: fee_bench [seed [trace_file]]
+ */
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+/** @brief Requests of the largest workload */
+#define BENCH_MAX_OPS           4000U
+/** @brief Reads of the read_during_swap workload */
+#define BENCH_SWAP_READS        20U
+/** @brief Ticks into the swap the read_during_swap workload reads at most, within
+           the erase of a cluster of group 0 */
+#define BENCH_SWAP_ERASE_TICKS  100UL
+
+/*==================================================================================================
+*                                             TYPES
+==================================================================================================*/
+/**
+* @brief        Block choice of a workload
+*/
+typedef enum
+{
+    BENCH_DIST_UNIFORM = 0,     /**< @brief every block alike */
+    BENCH_DIST_SMALL,           /**< @brief weight inverse to the block size */
+    BENCH_DIST_LARGE            /**< @brief weight proportional to the block size */
+} Bench_DistType;
+
+/**
+* @brief        Counters of the running workload
+*/
+typedef struct
+{
+    const char * szName;
+    uint32 u32Ops;
+    uint32 u32UserBytes;
+    uint32 u32Ticks;
+    uint32 u32StartTime;
+    uint64 u64StartHostNs;
+    uint32 u32StartSwaps;
+    Fls_Sim_SectorStatsType tStartTotals;
+    uint32 au32Latency[BENCH_MAX_OPS];
+} Bench_RunType;
+
+/*==================================================================================================
+*                                       LOCAL VARIABLES
+==================================================================================================*/
+static Bench_RunType Bench_tRun;
+
+static uint8 Bench_au8Buffer[FEE_HOST_MAX_BLOCK_SIZE];
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief        Stop the benchmark on a failure
+*/
+static void Bench_Fail( const char * szWhat, uint16 uBlockNumber )
+{
+    (void)fprintf( stderr, "fee_bench: %s: %s of block %u failed (result %d)\n",
+                   Bench_tRun.szName, szWhat, (unsigned)uBlockNumber, (int)Fee_GetJobResult() );
+    exit( 1 );
+}
+
+/**
+* @brief        Cluster swaps started since Fee_Init
+*/
+static uint32 Bench_GetSwaps( void )
+{
+    Fee_StatisticsType tStatistics;
+
+    Fee_GetStatistics( &tStatistics );
+
+    return( tStatistics.u32Swaps );
+}
+
+/**
+* @brief        Erase the flash image, power on and complete Fee_Init
+*/
+static void Bench_Start( const char * szName )
+{
+    uint32 u32Ticks;
+
+    FeeHost_EraseImage();
+    FeeHost_PowerOn( (boolean)FALSE );
+
+    if( FEE_HOST_IDLE != FeeHost_Run( &u32Ticks ) )
+    {
+        Bench_tRun.szName = szName;
+        Bench_Fail( "init", 0U );
+    }
+    else
+    {
+        /* Cluster formatted */
+    }
+
+    Bench_tRun.szName = szName;
+}
+
+/**
+* @brief        Start counting the timed part of a workload
+*/
+static void Bench_Begin( void )
+{
+    Bench_tRun.u32Ops = 0UL;
+    Bench_tRun.u32UserBytes = 0UL;
+    Bench_tRun.u32Ticks = 0UL;
+    Bench_tRun.u32StartTime = Fls_Sim_GetTime();
+    Bench_tRun.u32StartSwaps = Bench_GetSwaps();
+    Fls_Sim_GetTotals( &Bench_tRun.tStartTotals );
+    Fee_ResetLatency();
+    Bench_tRun.u64StartHostNs = FeeHost_GetTimeNs();
+}
+
+/**
+* @brief        Run an accepted request to its end and count it
+*/
+static void Bench_Complete( const char * szWhat, uint16 uBlockNumber )
+{
+    uint32 u32Ticks = 0UL;
+
+    if( FEE_HOST_IDLE != FeeHost_Run( &u32Ticks ) )
+    {
+        Bench_Fail( szWhat, uBlockNumber );
+    }
+    else
+    {
+        /* Request served */
+    }
+
+    if( Bench_tRun.u32Ops < BENCH_MAX_OPS )
+    {
+        Bench_tRun.au32Latency[Bench_tRun.u32Ops] = u32Ticks;
+    }
+    else
+    {
+        /* Latency not kept */
+    }
+
+    Bench_tRun.u32Ops++;
+    Bench_tRun.u32Ticks += u32Ticks;
+}
+
+/**
+* @brief        Write a block with random data
+*/
+static void Bench_Write( uint16 uBlockIndex )
+{
+    uint16 uBlockNumber = Fee_BlockConfig[uBlockIndex].blockNumber;
+    uint16 uSize = Fee_BlockConfig[uBlockIndex].blockSize;
+    uint16 uByte;
+
+    for( uByte = 0U; uByte < uSize; uByte++ )
+    {
+        Bench_au8Buffer[uByte] = (uint8)FeeHost_Random();
+    }
+
+    if( ((Std_ReturnType)E_OK) != Fee_Write( uBlockNumber, Bench_au8Buffer ) )
+    {
+        Bench_Fail( "Fee_Write", uBlockNumber );
+    }
+    else
+    {
+        Bench_Complete( "Fee_Write", uBlockNumber );
+    }
+
+    if( MEMIF_JOB_OK != FeeHost_GetJobResult() )
+    {
+        Bench_Fail( "Fee_Write", uBlockNumber );
+    }
+    else
+    {
+        Bench_tRun.u32UserBytes += uSize;
+    }
+}
+
+/**
+* @brief        Read a whole block
+*/
+static void Bench_Read( uint16 uBlockIndex )
+{
+    uint16 uBlockNumber = Fee_BlockConfig[uBlockIndex].blockNumber;
+
+    if( ((Std_ReturnType)E_OK) != Fee_Read( uBlockNumber, 0U, Bench_au8Buffer, Fee_BlockConfig[uBlockIndex].blockSize ) )
+    {
+        Bench_Fail( "Fee_Read", uBlockNumber );
+    }
+    else
+    {
+        Bench_Complete( "Fee_Read", uBlockNumber );
+    }
+
+    if( MEMIF_JOB_OK != FeeHost_GetJobResult() )
+    {
+        Bench_Fail( "Fee_Read", uBlockNumber );
+    }
+    else
+    {
+        /* Data read */
+    }
+}
+
+/**
+* @brief        Write every configured block once, untimed
+*/
+static void Bench_WriteAll( void )
+{
+    uint16 uBlockIndex;
+
+    for( uBlockIndex = 0U; uBlockIndex < FEE_CRT_CFG_NR_OF_BLOCKS; uBlockIndex++ )
+    {
+        Bench_Write( uBlockIndex );
+    }
+}
+
+/**
+* @brief        Compare function of qsort for the latencies
+*/
+static int Bench_CompareLatency( const void * pA, const void * pB )
+{
+    uint32 u32A = *(const uint32 *)pA;
+    uint32 u32B = *(const uint32 *)pB;
+
+    return( (u32A > u32B) - (u32A < u32B) );
+}
+
+/**
+* @brief        Print a histogram as a JSON array without its trailing empty buckets
+*/
+static void Bench_PrintHistogram( const char * szName, const uint32 * pu32Buckets )
+{
+    uint32 u32Used = FEE_LATENCY_BUCKETS;
+    uint32 u32Bucket;
+
+    while( (u32Used > 0UL) && (0UL == pu32Buckets[u32Used - 1UL]) )
+    {
+        u32Used--;
+    }
+
+    (void)printf( "\"%s\":[", szName );
+
+    for( u32Bucket = 0UL; u32Bucket < u32Used; u32Bucket++ )
+    {
+        (void)printf( "%s%lu", (0UL == u32Bucket) ? "" : ",", (unsigned long)pu32Buckets[u32Bucket] );
+    }
+
+    (void)printf( "]" );
+}
+
+/**
+* @brief        Print the Fee_GetLatency histograms of the services with requests
+*/
+static void Bench_PrintLatency( void )
+{
+    static const char * const aszApi[FEE_API_NONE] =
+    {
+        "Fee_Read", "Fee_Write", "Fee_InvalidateBlock", "Fee_EraseImmediateBlock"
+    };
+    static Fee_LatencyType tLatency;
+    const char * szSeparator = "";
+    uint32 u32Requests;
+    uint32 u32Bucket;
+    uint32 u32Api;
+
+    Fee_GetLatency( &tLatency );
+
+    (void)printf( ",\"fee_latency\":{" );
+
+    for( u32Api = 0UL; u32Api < (uint32)FEE_API_NONE; u32Api++ )
+    {
+        u32Requests = 0UL;
+
+        for( u32Bucket = 0UL; u32Bucket < FEE_LATENCY_BUCKETS; u32Bucket++ )
+        {
+            u32Requests += tLatency.atDirect[u32Api].au32Ticks[u32Bucket] + tLatency.atSwap[u32Api].au32Ticks[u32Bucket];
+        }
+
+        if( u32Requests > 0UL )
+        {
+            (void)printf( "%s\"%s\":{", szSeparator, aszApi[u32Api] );
+            Bench_PrintHistogram( "direct_ticks", tLatency.atDirect[u32Api].au32Ticks );
+            (void)printf( "," );
+            Bench_PrintHistogram( "swap_ticks", tLatency.atSwap[u32Api].au32Ticks );
+            (void)printf( "," );
+            Bench_PrintHistogram( "direct_us", tLatency.atDirect[u32Api].au32Time );
+            (void)printf( "," );
+            Bench_PrintHistogram( "swap_us", tLatency.atSwap[u32Api].au32Time );
+            (void)printf( "}" );
+            szSeparator = ",";
+        }
+        else
+        {
+            /* Service not used by the workload */
+        }
+    }
+
+    (void)printf( "}" );
+}
+
+/**
+* @brief        Print the metrics of the workload run since Bench_Begin
+*/
+static void Bench_Report( void )
+{
+    Fls_Sim_SectorStatsType tTotals;
+    uint32 u32Kept = (Bench_tRun.u32Ops < BENCH_MAX_OPS) ? Bench_tRun.u32Ops : BENCH_MAX_OPS;
+    uint32 u32Time = Fls_Sim_GetTime() - Bench_tRun.u32StartTime;
+    uint64 u64HostNs = FeeHost_GetTimeNs() - Bench_tRun.u64StartHostNs;
+    uint32 u32ProgBytes;
+    uint32 u32P50 = 0UL;
+    uint32 u32P99 = 0UL;
+    uint32 u32Max = 0UL;
+
+    Fls_Sim_GetTotals( &tTotals );
+    u32ProgBytes = tTotals.u32ProgramBytes - Bench_tRun.tStartTotals.u32ProgramBytes;
+
+    if( u32Kept > 0UL )
+    {
+        qsort( Bench_tRun.au32Latency, u32Kept, sizeof(uint32), &Bench_CompareLatency );
+        u32P50 = Bench_tRun.au32Latency[(u32Kept - 1UL) / 2UL];
+        u32P99 = Bench_tRun.au32Latency[((u32Kept * 99UL) + 99UL) / 100UL - 1UL];
+        u32Max = Bench_tRun.au32Latency[u32Kept - 1UL];
+    }
+    else
+    {
+        /* No request */
+    }
+
+    (void)printf( "{\"workload\":\"%s\",\"ops\":%lu,\"ops_per_s\":%.1f,\"host_ops_per_s\":%.0f,"
+                  "\"ticks_per_op\":%.2f,\"lat_p50\":%lu,\"lat_p99\":%lu,\"lat_max\":%lu,"
+                  "\"user_bytes\":%lu,\"prog_bytes\":%lu,\"write_amp\":%.2f,\"read_bytes\":%lu,"
+                  "\"erases\":%lu,\"swaps\":%lu",
+                  Bench_tRun.szName,
+                  (unsigned long)Bench_tRun.u32Ops,
+                  (0UL != u32Time) ? ((double)Bench_tRun.u32Ops * 1.0e6) / (double)u32Time : 0.0,
+                  (0ULL != u64HostNs) ? ((double)Bench_tRun.u32Ops * 1.0e9) / (double)u64HostNs : 0.0,
+                  (0UL != Bench_tRun.u32Ops) ? (double)Bench_tRun.u32Ticks / (double)Bench_tRun.u32Ops : 0.0,
+                  (unsigned long)u32P50, (unsigned long)u32P99, (unsigned long)u32Max,
+                  (unsigned long)Bench_tRun.u32UserBytes,
+                  (unsigned long)u32ProgBytes,
+                  (0UL != Bench_tRun.u32UserBytes) ? (double)u32ProgBytes / (double)Bench_tRun.u32UserBytes : 0.0,
+                  (unsigned long)(tTotals.u32ReadBytes - Bench_tRun.tStartTotals.u32ReadBytes),
+                  (unsigned long)(tTotals.u32EraseCount - Bench_tRun.tStartTotals.u32EraseCount),
+                  (unsigned long)(Bench_GetSwaps() - Bench_tRun.u32StartSwaps) );
+    Bench_PrintLatency();
+    (void)printf( "}\n" );
+}
+
+/**
+* @brief        Pick a block index by the distribution
+*/
+static uint16 Bench_PickBlock( Bench_DistType eDist )
+{
+    uint32 au32Weight[FEE_CRT_CFG_NR_OF_BLOCKS];
+    uint32 u32Sum = 0UL;
+    uint32 u32Pick;
+    uint16 uBlockIndex;
+    uint16 uSize;
+
+    for( uBlockIndex = 0U; uBlockIndex < FEE_CRT_CFG_NR_OF_BLOCKS; uBlockIndex++ )
+    {
+        uSize = Fee_BlockConfig[uBlockIndex].blockSize;
+
+        if( BENCH_DIST_SMALL == eDist )
+        {
+            au32Weight[uBlockIndex] = 512UL / uSize;
+        }
+        else if( BENCH_DIST_LARGE == eDist )
+        {
+            au32Weight[uBlockIndex] = uSize;
+        }
+        else
+        {
+            au32Weight[uBlockIndex] = 1UL;
+        }
+
+        u32Sum += au32Weight[uBlockIndex];
+    }
+
+    u32Pick = FeeHost_Random() % u32Sum;
+
+    for( uBlockIndex = 0U; u32Pick >= au32Weight[uBlockIndex]; uBlockIndex++ )
+    {
+        u32Pick -= au32Weight[uBlockIndex];
+    }
+
+    return( uBlockIndex );
+}
+
+/**
+* @brief        Sequential writes of the blocks up to 16 bytes
+*/
+static void Bench_SequentialSmall( void )
+{
+    uint32 u32Op = 0UL;
+    uint16 uBlockIndex = 0U;
+
+    Bench_Start( "seq_small_write" );
+    Bench_Begin();
+
+    while( u32Op < 2000UL )
+    {
+        if( Fee_BlockConfig[uBlockIndex].blockSize <= 16U )
+        {
+            Bench_Write( uBlockIndex );
+            u32Op++;
+        }
+        else
+        {
+            /* Not a small block */
+        }
+
+        uBlockIndex = (uint16)((uBlockIndex + 1U) % FEE_CRT_CFG_NR_OF_BLOCKS);
+    }
+
+    Bench_Report();
+}
+
+/**
+* @brief        70 % reads and 30 % writes of blocks picked by a distribution
+*/
+static void Bench_Mixed( const char * szName, Bench_DistType eDist )
+{
+    uint32 u32Op;
+    uint16 uBlockIndex;
+
+    Bench_Start( szName );
+    Bench_WriteAll();
+    Bench_Begin();
+
+    for( u32Op = 0UL; u32Op < 3000UL; u32Op++ )
+    {
+        uBlockIndex = Bench_PickBlock( eDist );
+
+        if( (FeeHost_Random() % 10UL) < 7UL )
+        {
+            Bench_Read( uBlockIndex );
+        }
+        else
+        {
+            Bench_Write( uBlockIndex );
+        }
+    }
+
+    Bench_Report();
+}
+
+/**
+* @brief        Back-to-back writes of the largest blocks, forcing cluster swaps
+*/
+static void Bench_WriteStorm( void )
+{
+    uint32 u32Op;
+    uint16 uBlockIndex;
+    uint16 uLargest = 0U;
+
+    Bench_Start( "write_storm" );
+    Bench_WriteAll();
+
+    for( uBlockIndex = 0U; uBlockIndex < FEE_CRT_CFG_NR_OF_BLOCKS; uBlockIndex++ )
+    {
+        if( Fee_BlockConfig[uBlockIndex].blockSize > uLargest )
+        {
+            uLargest = Fee_BlockConfig[uBlockIndex].blockSize;
+        }
+        else
+        {
+            /* Smaller block */
+        }
+    }
+
+    Bench_Begin();
+
+    for( u32Op = 0UL; u32Op < 1000UL; )
+    {
+        uBlockIndex = (uint16)(FeeHost_Random() % FEE_CRT_CFG_NR_OF_BLOCKS);
+
+        if( uLargest == Fee_BlockConfig[uBlockIndex].blockSize )
+        {
+            Bench_Write( uBlockIndex );
+            u32Op++;
+        }
+        else
+        {
+            /* Storm on the largest blocks only */
+        }
+    }
+
+    Bench_Report();
+}
+
+/**
+* @brief        Run the main functions for one tick of the virtual clock
+*/
+static void Bench_Tick( void )
+{
+    Fee_MainFunction();
+    Fls_MainFunction();
+    Fls_Sim_AdvanceTime( FEE_HOST_TICK_US );
+}
+
+/**
+* @brief        Retry Fee_Read of a random cluster group 0 block every tick until
+*               the data is read
+*
+* @param[out]   pu32Ticks       ticks from the first try until the data is read
+* @param[out]   pu32Time        virtual us from the first try until the data is read
+*
+* @return       TRUE when Fee served the read while the swap erased
+*/
+static boolean Bench_SwapRead( uint32 * pu32Ticks, uint32 * pu32Time )
+{
+    uint32 u32Start = Fls_Sim_GetTime();
+    uint32 u32Ticks = 0UL;
+    uint16 uBlockIndex;
+    boolean bAccepted = (boolean)FALSE;
+    boolean bInErase = (boolean)FALSE;
+    boolean bDone = (boolean)FALSE;
+
+    do
+    {
+        uBlockIndex = (uint16)(FeeHost_Random() % FEE_CRT_CFG_NR_OF_BLOCKS);
+    } while( 0U != Fee_BlockConfig[uBlockIndex].clrGrp );
+
+    while( (boolean)FALSE == bDone )
+    {
+        if( (boolean)FALSE == bAccepted )
+        {
+            bAccepted = (boolean)(((Std_ReturnType)E_OK) ==
+                Fee_Read( Fee_BlockConfig[uBlockIndex].blockNumber, 0U, Bench_au8Buffer,
+                          Fee_BlockConfig[uBlockIndex].blockSize ));
+            bInErase = (boolean)(MEMIF_BUSY_INTERNAL == Fee_GetStatus());
+        }
+        else
+        {
+            /* Read accepted, wait for its end */
+        }
+
+        if( (boolean)TRUE == bInErase )
+        {
+            /* Read served in between, the swap goes on */
+            bDone = (boolean)(MEMIF_JOB_PENDING != Fee_GetJobResult());
+        }
+        else
+        {
+            bDone = (boolean)(((boolean)TRUE == bAccepted) && (MEMIF_IDLE == Fee_GetStatus()));
+        }
+
+        if( (boolean)FALSE == bDone )
+        {
+            Bench_Tick();
+            u32Ticks++;
+        }
+        else
+        {
+            /* Data read */
+        }
+
+        if( u32Ticks >= FEE_HOST_MAX_TICKS )
+        {
+            Bench_Fail( "Fee_Read", Fee_BlockConfig[uBlockIndex].blockNumber );
+        }
+        else
+        {
+            /* Keep trying */
+        }
+    }
+
+    if( MEMIF_JOB_OK != FeeHost_GetJobResult() )
+    {
+        Bench_Fail( "Fee_Read", Fee_BlockConfig[uBlockIndex].blockNumber );
+    }
+    else
+    {
+        *pu32Ticks = u32Ticks;
+        *pu32Time = Fls_Sim_GetTime() - u32Start;
+    }
+
+    return( bInErase );
+}
+
+/**
+* @brief        Fee_Read of a cluster group 0 block while the cluster swap erases
+*
+* @details      A write of the largest group 0 block starts the swap and Fee_Cancel
+*               turns it into an internal swap a random number of ticks into the
+*               erase of the target cluster, then Bench_SwapRead reads. A swap
+*               started by a write keeps Fee MEMIF_BUSY, Fee_Read is refused then
+*               with or without FEE_READ_DURING_ERASE.
+*/
+static void Bench_ReadDuringSwap( void )
+{
+    uint32 au32Time[BENCH_SWAP_READS];
+    Fls_Sim_SectorStatsType tTotals;
+    uint32 u32Served = 0UL;
+    uint32 u32Reads = 0UL;
+    uint32 u32Swaps;
+    uint32 u32Wait;
+    uint32 u32Ticks;
+    uint16 uBlockIndex;
+    uint16 uLargest = 0U;
+    uint16 uByte;
+
+    Bench_Start( "read_during_swap" );
+    Bench_WriteAll();
+
+    for( uBlockIndex = 0U; uBlockIndex < FEE_CRT_CFG_NR_OF_BLOCKS; uBlockIndex++ )
+    {
+        if( (0U == Fee_BlockConfig[uBlockIndex].clrGrp) &&
+            (Fee_BlockConfig[uBlockIndex].blockSize > Fee_BlockConfig[uLargest].blockSize)
+          )
+        {
+            uLargest = uBlockIndex;
+        }
+        else
+        {
+            /* Smaller block or other cluster group */
+        }
+    }
+
+    Fls_Sim_GetTotals( &Bench_tRun.tStartTotals );
+
+    while( u32Reads < BENCH_SWAP_READS )
+    {
+        for( uByte = 0U; uByte < Fee_BlockConfig[uLargest].blockSize; uByte++ )
+        {
+            Bench_au8Buffer[uByte] = (uint8)FeeHost_Random();
+        }
+
+        u32Swaps = Bench_GetSwaps();
+
+        if( ((Std_ReturnType)E_OK) != Fee_Write( Fee_BlockConfig[uLargest].blockNumber, Bench_au8Buffer ) )
+        {
+            Bench_Fail( "Fee_Write", Fee_BlockConfig[uLargest].blockNumber );
+        }
+        else
+        {
+            /* Run the write until it ends or starts a swap */
+        }
+
+        while( (MEMIF_IDLE != Fee_GetStatus()) && (u32Swaps == Bench_GetSwaps()) )
+        {
+            Bench_Tick();
+        }
+
+        if( u32Swaps != Bench_GetSwaps() )
+        {
+            for( u32Wait = FeeHost_Random() % BENCH_SWAP_ERASE_TICKS;
+                 (u32Wait > 0UL) && (MEMIF_IDLE != Fee_GetStatus());
+                 u32Wait-- )
+            {
+                Bench_Tick();
+            }
+
+            Fee_Cancel();
+
+            u32Served += (uint32)Bench_SwapRead( &Bench_tRun.au32Latency[u32Reads], &au32Time[u32Reads] );
+            u32Reads++;
+
+            /* Complete the swap untimed */
+            if( FEE_HOST_IDLE != FeeHost_Run( &u32Ticks ) )
+            {
+                Bench_Fail( "swap", 0U );
+            }
+            else
+            {
+                /* Swap done */
+            }
+        }
+        else
+        {
+            /* Written without a swap, write again */
+        }
+    }
+
+    qsort( Bench_tRun.au32Latency, u32Reads, sizeof(uint32), &Bench_CompareLatency );
+    qsort( au32Time, u32Reads, sizeof(uint32), &Bench_CompareLatency );
+    Fls_Sim_GetTotals( &tTotals );
+
+    (void)printf( "{\"workload\":\"%s\",\"read_during_erase\":%d,\"reads\":%lu,\"served_in_erase\":%lu,"
+                  "\"lat_p50\":%lu,\"lat_max\":%lu,\"lat_p50_us\":%lu,\"lat_max_us\":%lu,"
+                  "\"erase_suspends\":%lu}\n",
+                  Bench_tRun.szName,
+                  (FEE_READ_DURING_ERASE == STD_ON) ? 1 : 0,
+                  (unsigned long)u32Reads, (unsigned long)u32Served,
+                  (unsigned long)Bench_tRun.au32Latency[(u32Reads - 1UL) / 2UL],
+                  (unsigned long)Bench_tRun.au32Latency[u32Reads - 1UL],
+                  (unsigned long)au32Time[(u32Reads - 1UL) / 2UL],
+                  (unsigned long)au32Time[u32Reads - 1UL],
+                  (unsigned long)(tTotals.u32EraseSuspends - Bench_tRun.tStartTotals.u32EraseSuspends) );
+}
+
+/**
+* @brief        Run Fls_Erase to its end outside of Fee
+*
+* @param[in]    u32Addr         first address to erase
+* @param[in]    u32Length       number of bytes to erase
+* @param[out]   pu32Ticks       Fls_MainFunction ticks taken
+* @param[out]   pu32Time        virtual us taken
+*/
+static void Bench_FlsErase( uint32 u32Addr, uint32 u32Length, uint32 * pu32Ticks, uint32 * pu32Time )
+{
+    uint32 u32Start = Fls_Sim_GetTime();
+    uint32 u32Ticks = 0UL;
+
+    if( ((Std_ReturnType)E_OK) != Fls_Erase( u32Addr, u32Length ) )
+    {
+        Bench_Fail( "Fls_Erase", 0U );
+    }
+    else
+    {
+        /* Erase started */
+    }
+
+    while( (MEMIF_JOB_PENDING == Fls_GetJobResult()) && (u32Ticks < FEE_HOST_MAX_TICKS) )
+    {
+        Fls_MainFunction();
+        Fls_Sim_AdvanceTime( FEE_HOST_TICK_US );
+        u32Ticks++;
+    }
+
+    if( MEMIF_JOB_OK != Fls_GetJobResult() )
+    {
+        Bench_Fail( "Fls_Erase", 0U );
+    }
+    else
+    {
+        *pu32Ticks = u32Ticks;
+        *pu32Time = Fls_Sim_GetTime() - u32Start;
+    }
+}
+
+/**
+* @brief        Fls_Erase time of a cluster of group 0 and of the whole flash
+*
+* @details      A Fee cluster is smaller than a bank and is erased sector by
+*               sector with or without FLS_BLOCK_ERASE, the whole flash is one
+*               bank of the model and is block erased with it.
+*/
+static void Bench_EraseTime( void )
+{
+    uint32 u32FlashSize = (*(Fls_pConfigPtr->paSectorEndAddr))[Fls_pConfigPtr->u32SectorCount - 1UL] + 1UL;
+    uint32 u32ClrTicks = 0UL;
+    uint32 u32ClrTime = 0UL;
+    uint32 u32BankTicks = 0UL;
+    uint32 u32BankTime = 0UL;
+
+    Bench_Start( "erase_time" );
+    Bench_FlsErase( Fee_ClrGrps[0].clrPtr[0].startAddr, Fee_ClrGrps[0].clrPtr[0].length, &u32ClrTicks, &u32ClrTime );
+    Bench_FlsErase( 0UL, u32FlashSize, &u32BankTicks, &u32BankTime );
+
+    (void)printf( "{\"workload\":\"%s\",\"block_erase\":%d,\"cluster_bytes\":%lu,\"cluster_ticks\":%lu,"
+                  "\"cluster_us\":%lu,\"bank_bytes\":%lu,\"bank_ticks\":%lu,\"bank_us\":%lu}\n",
+                  Bench_tRun.szName,
+                  (FLS_BLOCK_ERASE == STD_ON) ? 1 : 0,
+                  (unsigned long)Fee_ClrGrps[0].clrPtr[0].length,
+                  (unsigned long)u32ClrTicks, (unsigned long)u32ClrTime,
+                  (unsigned long)u32FlashSize,
+                  (unsigned long)u32BankTicks, (unsigned long)u32BankTime );
+}
+
+/**
+* @brief        Write the Fee trace ring buffer to a file
+*/
+static void Bench_DumpTrace( const char * szFile )
+{
+    FILE * pFile = fopen( szFile, "wb" );
+
+    if( (NULL_PTR == pFile) ||
+        (1U != fwrite( Fee_GetTrace(), sizeof(Fee_TraceType), 1U, pFile )) ||
+        (0 != fclose( pFile ))
+      )
+    {
+        (void)fprintf( stderr, "fee_bench: can't write the trace to %s\n", szFile );
+        exit( 1 );
+    }
+    else
+    {
+        /* Trace dumped */
+    }
+}
+
+/**
+* @brief        Fee_Init after filling cluster group 0 to a level
+*
+* @param[in]    u32Fill         fill level of the active cluster in per mille
+*/
+static void Bench_ColdInit( uint32 u32Fill )
+{
+    static char szName[32];
+    uint32 u32Ticks = 0UL;
+    uint16 uBlockIndex;
+
+    (void)snprintf( szName, sizeof(szName), "cold_init_fill_%lu", (unsigned long)(u32Fill / 10UL) );
+    Bench_Start( szName );
+
+    while( FeeHost_GetFill( 0U ) < u32Fill )
+    {
+        uBlockIndex = Bench_PickBlock( BENCH_DIST_UNIFORM );
+
+        if( 0U == Fee_BlockConfig[uBlockIndex].clrGrp )
+        {
+            Bench_Write( uBlockIndex );
+        }
+        else
+        {
+            /* Fill cluster group 0 only */
+        }
+    }
+
+    Bench_Begin();
+    FeeHost_PowerOn( (boolean)FALSE );
+
+    if( FEE_HOST_IDLE != FeeHost_Run( &u32Ticks ) )
+    {
+        Bench_Fail( "Fee_Init", 0U );
+    }
+    else
+    {
+        Bench_tRun.au32Latency[0] = u32Ticks;
+        Bench_tRun.u32Ops = 1UL;
+        Bench_tRun.u32Ticks = u32Ticks;
+    }
+
+    Bench_Report();
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+int main( int argc, char * argv[] )
+{
+    static const uint32 au32Fill[] = { 0UL, 250UL, 500UL, 750UL, 900UL };
+    uint32 u32Seed = (argc > 1) ? (uint32)strtoul( argv[1], NULL_PTR, 0 ) : 1UL;
+    uint32 u32Fill;
+
+    FeeHost_Seed( u32Seed );
+
+    Bench_SequentialSmall();
+    Bench_Mixed( "mixed_uniform", BENCH_DIST_UNIFORM );
+    Bench_Mixed( "mixed_small", BENCH_DIST_SMALL );
+    Bench_Mixed( "mixed_large", BENCH_DIST_LARGE );
+    Bench_WriteStorm();
+
+    if( argc > 2 )
+    {
+        Bench_DumpTrace( argv[2] );
+    }
+    else
+    {
+        /* No trace requested */
+    }
+
+    for( u32Fill = 0UL; u32Fill < (sizeof(au32Fill) / sizeof(au32Fill[0])); u32Fill++ )
+    {
+        Bench_ColdInit( au32Fill[u32Fill] );
+    }
+
+    Bench_ReadDuringSwap();
+    Bench_EraseTime();
+
+    FeeHost_EraseImage();
+
+    return( 0 );
+}
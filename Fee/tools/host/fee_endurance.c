@@ -0,0 +1,362 @@
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fee_host.h"
+
+/*
+ * Endurance replay on the host flash model.
+ *
+ * A per-block write-rate profile is replayed through Fee in drive time, with the
+ * model in fast forward so that only the Fee/Fls code costs host time. Profile
+ * lines are
+ *
+ *   block <number> every <period> ms
+ *
+ * '#' starts a comment. Every block of the profile is written once per period
+ * with new data, starting one period after power-on. The report gives the erase
+ * count of every sector, the swaps per cluster group and per drive hour, the
+ * write amplification and the drive time until the most erased sector reaches
+ * the endurance.
+ *
+ * Usage: fee_endurance profile [drive_hours [endurance_cycles]]
+ */
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+#define END_MS_PER_HOUR         3600000ULL
+
+/** @brief Default program/erase cycles of a data flash sector */
+#define END_ENDURANCE           100000UL
+
+/*==================================================================================================
+*                                             TYPES
+==================================================================================================*/
+/**
+* @brief        Profile entry of a block
+*/
+typedef struct
+{
+    uint16 uBlockIndex;
+    uint64 u64PeriodMs;
+    uint64 u64DueMs;
+    uint32 u32Writes;
+} End_EntryType;
+
+/*==================================================================================================
+*                                       LOCAL VARIABLES
+==================================================================================================*/
+static End_EntryType End_atEntry[FEE_CRT_CFG_NR_OF_BLOCKS];
+
+static uint16 End_uEntries = 0U;
+
+static uint8 End_au8Buffer[FEE_HOST_MAX_BLOCK_SIZE];
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief        Index of a configured block, FEE_CRT_CFG_NR_OF_BLOCKS if unknown
+*/
+static uint16 End_GetBlockIndex( uint32 u32BlockNumber )
+{
+    uint16 uBlockIndex = 0U;
+
+    while( (uBlockIndex < FEE_CRT_CFG_NR_OF_BLOCKS) && (Fee_BlockConfig[uBlockIndex].blockNumber != u32BlockNumber) )
+    {
+        uBlockIndex++;
+    }
+
+    return( uBlockIndex );
+}
+
+/**
+* @brief        Read the write-rate profile
+*
+* @return       TRUE when the profile is valid and not empty
+*/
+static boolean End_LoadProfile( const char * szFile )
+{
+    boolean bRetVal = (boolean)TRUE;
+    char szLine[128];
+    char * pComment;
+    unsigned int uBlockNumber;
+    unsigned long ulPeriod;
+    uint32 u32Line = 0UL;
+    uint16 uBlockIndex;
+    FILE * pFile = fopen( szFile, "r" );
+
+    if( NULL_PTR == pFile )
+    {
+        (void)fprintf( stderr, "fee_endurance: can't open %s\n", szFile );
+        bRetVal = (boolean)FALSE;
+    }
+    else
+    {
+        while( ((boolean)TRUE == bRetVal) && (NULL_PTR != fgets( szLine, (int)sizeof(szLine), pFile )) )
+        {
+            u32Line++;
+            pComment = strchr( szLine, '#' );
+
+            if( NULL_PTR != pComment )
+            {
+                *pComment = '\0';
+            }
+            else
+            {
+                /* No comment */
+            }
+
+            if( strspn( szLine, " \t\r\n" ) == strlen( szLine ) )
+            {
+                /* Blank line */
+            }
+            else if( (2 != sscanf( szLine, " block %u every %lu ms", &uBlockNumber, &ulPeriod )) || (0UL == ulPeriod) )
+            {
+                (void)fprintf( stderr, "fee_endurance: %s:%lu: expected \"block <number> every <period> ms\"\n",
+                               szFile, (unsigned long)u32Line );
+                bRetVal = (boolean)FALSE;
+            }
+            else
+            {
+                uBlockIndex = End_GetBlockIndex( uBlockNumber );
+
+                if( (FEE_CRT_CFG_NR_OF_BLOCKS == uBlockIndex) || (End_uEntries >= FEE_CRT_CFG_NR_OF_BLOCKS) )
+                {
+                    (void)fprintf( stderr, "fee_endurance: %s:%lu: block %u not configured or listed twice\n",
+                                   szFile, (unsigned long)u32Line, uBlockNumber );
+                    bRetVal = (boolean)FALSE;
+                }
+                else
+                {
+                    End_atEntry[End_uEntries].uBlockIndex = uBlockIndex;
+                    End_atEntry[End_uEntries].u64PeriodMs = ulPeriod;
+                    End_atEntry[End_uEntries].u64DueMs = ulPeriod;
+                    End_atEntry[End_uEntries].u32Writes = 0UL;
+                    End_uEntries++;
+                }
+            }
+        }
+
+        (void)fclose( pFile );
+
+        if( 0U == End_uEntries )
+        {
+            bRetVal = (boolean)FALSE;
+        }
+        else
+        {
+            /* Profile loaded */
+        }
+    }
+
+    return( bRetVal );
+}
+
+/**
+* @brief        Write a block with new data
+*/
+static boolean End_Write( uint16 uBlockIndex )
+{
+    boolean bRetVal = (boolean)FALSE;
+    uint32 u32Ticks;
+    uint16 uByte;
+
+    for( uByte = 0U; uByte < Fee_BlockConfig[uBlockIndex].blockSize; uByte++ )
+    {
+        End_au8Buffer[uByte] = (uint8)FeeHost_Random();
+    }
+
+    if( (((Std_ReturnType)E_OK) == Fee_Write( Fee_BlockConfig[uBlockIndex].blockNumber, End_au8Buffer )) &&
+        (FEE_HOST_IDLE == FeeHost_Run( &u32Ticks )) &&
+        (MEMIF_JOB_OK == FeeHost_GetJobResult())
+      )
+    {
+        bRetVal = (boolean)TRUE;
+    }
+    else
+    {
+        (void)fprintf( stderr, "fee_endurance: write of block %u failed\n",
+                       (unsigned)Fee_BlockConfig[uBlockIndex].blockNumber );
+    }
+
+    return( bRetVal );
+}
+
+/**
+* @brief        Print the replay report
+*/
+static void End_Report( uint64 u64DriveMs, uint32 u32Endurance, uint64 u64UserBytes, uint64 u64HostNs )
+{
+    const Fls_Sim_SectorStatsType * pStats;
+    Fls_Sim_SectorStatsType tTotals;
+    Fee_StatisticsType tStatistics;
+    double dHours = (double)u64DriveMs / (double)END_MS_PER_HOUR;
+    uint32 au32GroupErases[FEE_NUMBER_OF_CLUSTER_GROUPS];
+    uint32 au32GroupSectors[FEE_NUMBER_OF_CLUSTER_GROUPS];
+    uint32 u32MaxErases = 0UL;
+    uint32 u32Writes = 0UL;
+    uint32 u32Sector;
+    uint32 u32Clr;
+    uint16 uEntry;
+    uint8 uClrGrp;
+    Fls_AddressType uStart;
+
+    Fls_Sim_GetTotals( &tTotals );
+    Fee_GetStatistics( &tStatistics );
+    (void)memset( au32GroupErases, 0, sizeof(au32GroupErases) );
+    (void)memset( au32GroupSectors, 0, sizeof(au32GroupSectors) );
+
+    for( uEntry = 0U; uEntry < End_uEntries; uEntry++ )
+    {
+        u32Writes += End_atEntry[uEntry].u32Writes;
+    }
+
+    (void)printf( "drive time            %.1f h\n", dHours );
+    (void)printf( "writes                %lu (%.0f per drive hour)\n", (unsigned long)u32Writes, (double)u32Writes / dHours );
+    (void)printf( "user bytes            %llu\n", (unsigned long long)u64UserBytes );
+    (void)printf( "programmed bytes      %lu\n", (unsigned long)tTotals.u32ProgramBytes );
+    (void)printf( "write amplification   %.2f\n", (double)tTotals.u32ProgramBytes / (double)u64UserBytes );
+    (void)printf( "host time             %.1f s\n\n", (double)u64HostNs / 1.0e9 );
+
+    (void)printf( "sector  start  group  erases\n" );
+
+    for( u32Sector = 0UL; u32Sector < Fls_Config.u32SectorCount; u32Sector++ )
+    {
+        pStats = Fls_Sim_GetSectorStats( u32Sector );
+        uStart = (*(Fls_Config.paSectorStartAddr))[u32Sector];
+
+        for( uClrGrp = 0U; uClrGrp < FEE_NUMBER_OF_CLUSTER_GROUPS; uClrGrp++ )
+        {
+            for( u32Clr = 0UL; u32Clr < Fee_ClrGrps[uClrGrp].clrCount; u32Clr++ )
+            {
+                if( (uStart >= Fee_ClrGrps[uClrGrp].clrPtr[u32Clr].startAddr) &&
+                    (uStart < (Fee_ClrGrps[uClrGrp].clrPtr[u32Clr].startAddr + Fee_ClrGrps[uClrGrp].clrPtr[u32Clr].length))
+                  )
+                {
+                    au32GroupErases[uClrGrp] += pStats->u32EraseCount;
+                    au32GroupSectors[uClrGrp]++;
+                    (void)printf( "%6lu %6lu %6u %7lu\n", (unsigned long)u32Sector, (unsigned long)uStart,
+                                  (unsigned)uClrGrp, (unsigned long)pStats->u32EraseCount );
+                }
+                else
+                {
+                    /* Sector outside this cluster */
+                }
+            }
+        }
+
+        if( pStats->u32EraseCount > u32MaxErases )
+        {
+            u32MaxErases = pStats->u32EraseCount;
+        }
+        else
+        {
+            /* Less worn sector */
+        }
+    }
+
+    (void)printf( "\ngroup  format    swaps  swaps/h\n" );
+
+    for( uClrGrp = 0U; uClrGrp < FEE_NUMBER_OF_CLUSTER_GROUPS; uClrGrp++ )
+    {
+        /* A swap erases the sectors of one cluster, the first format of Fee_Init too */
+        double dSwaps = (double)au32GroupErases[uClrGrp] * (double)Fee_ClrGrps[uClrGrp].clrCount /
+                        (double)au32GroupSectors[uClrGrp] - 1.0;
+
+        (void)printf( "%5u  %-8s %7.0f %8.2f\n", (unsigned)uClrGrp,
+                      (FEE_RECORD_COMPACT == Fee_ClrGrps[uClrGrp].recordFormat) ? "compact" : "standard",
+                      dSwaps, dSwaps / dHours );
+    }
+
+    (void)printf( "\nswaps (Fee statistics) %lu, %.2f per drive hour\n", (unsigned long)tStatistics.u32Swaps,
+                  (double)tStatistics.u32Swaps / dHours );
+    (void)printf( "max sector erases      %lu of %lu cycles\n", (unsigned long)u32MaxErases, (unsigned long)u32Endurance );
+
+    if( u32MaxErases > 0UL )
+    {
+        (void)printf( "drive time to wear out %.0f h\n", dHours * (double)u32Endurance / (double)u32MaxErases );
+    }
+    else
+    {
+        (void)printf( "drive time to wear out unbounded, no sector erased\n" );
+    }
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+int main( int argc, char * argv[] )
+{
+    double dHours = (argc > 2) ? strtod( argv[2], NULL_PTR ) : 100.0;
+    uint32 u32Endurance = (argc > 3) ? (uint32)strtoul( argv[3], NULL_PTR, 0 ) : END_ENDURANCE;
+    uint64 u64EndMs = (uint64)(dHours * (double)END_MS_PER_HOUR);
+    uint64 u64NowMs = 0ULL;
+    uint64 u64UserBytes = 0ULL;
+    uint64 u64HostNs;
+    uint32 u32Ticks;
+    uint16 uEntry;
+    uint16 uNext;
+    int iRetVal = 0;
+
+    if( (argc < 2) || ((boolean)FALSE == End_LoadProfile( argv[1] )) )
+    {
+        (void)fprintf( stderr, "usage: fee_endurance profile [drive_hours [endurance_cycles]]\n" );
+        iRetVal = 2;
+    }
+    else
+    {
+        u64HostNs = FeeHost_GetTimeNs();
+        FeeHost_EraseImage();
+        FeeHost_PowerOn( (boolean)TRUE );
+        (void)FeeHost_Run( &u32Ticks );
+
+        while( (0 == iRetVal) && (u64NowMs <= u64EndMs) )
+        {
+            uNext = 0U;
+
+            for( uEntry = 1U; uEntry < End_uEntries; uEntry++ )
+            {
+                if( End_atEntry[uEntry].u64DueMs < End_atEntry[uNext].u64DueMs )
+                {
+                    uNext = uEntry;
+                }
+                else
+                {
+                    /* Due later */
+                }
+            }
+
+            u64NowMs = End_atEntry[uNext].u64DueMs;
+
+            if( u64NowMs <= u64EndMs )
+            {
+                if( (boolean)TRUE == End_Write( End_atEntry[uNext].uBlockIndex ) )
+                {
+                    End_atEntry[uNext].u32Writes++;
+                    End_atEntry[uNext].u64DueMs += End_atEntry[uNext].u64PeriodMs;
+                    u64UserBytes += Fee_BlockConfig[End_atEntry[uNext].uBlockIndex].blockSize;
+                }
+                else
+                {
+                    iRetVal = 1;
+                }
+            }
+            else
+            {
+                /* Drive time over */
+            }
+        }
+
+        End_Report( u64EndMs, u32Endurance, u64UserBytes, FeeHost_GetTimeNs() - u64HostNs );
+        FeeHost_EraseImage();
+    }
+
+    return( iRetVal );
+}
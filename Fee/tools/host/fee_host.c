@@ -0,0 +1,175 @@
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include <time.h>
+#include <unistd.h>
+#include "fee_host.h"
+
+/*==================================================================================================
+*                                       LOCAL VARIABLES
+==================================================================================================*/
+/** @brief State of the xorshift32 generator of the workloads */
+static uint32 FeeHost_u32Random = 1UL;
+
+/** @brief Fast forward mode of the current power-on */
+static boolean FeeHost_bFastForward = (boolean)FALSE;
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief        Unmap the flash image and delete its file, the next Fls_Init
+*               starts on an erased array
+*/
+void FeeHost_EraseImage( void )
+{
+    Fls_Sim_Deinit();
+    (void)unlink( FLS_SIM_IMAGE_FILE );
+}
+
+/**
+* @brief        Initialize Fls and start Fee_Init, FeeHost_Run completes the
+*               cluster scan
+*
+* @param[in]    bFastForward    complete flash operations without waiting for
+*                               the virtual clock
+*/
+void FeeHost_PowerOn( boolean bFastForward )
+{
+    FeeHost_bFastForward = bFastForward;
+    Fls_Init();
+    Fls_Sim_SetFastForward( bFastForward );
+    Fee_Init();
+}
+
+/**
+* @brief        Run the main functions until Fee is idle
+*
+* @details      Every tick calls Fee_MainFunction and Fls_MainFunction once and,
+*               out of fast forward, moves the virtual clock by FEE_HOST_TICK_US.
+*               The completion interrupt of an IRQ mode sector is raised between
+*               the ticks.
+*
+* @param[out]   pu32Ticks       main function ticks taken
+* @return       FeeHost_RunType
+*/
+FeeHost_RunType FeeHost_Run( uint32 * pu32Ticks )
+{
+    FeeHost_RunType eRetVal = FEE_HOST_IDLE;
+    uint32 u32Ticks = 0UL;
+
+    while( (FEE_HOST_IDLE == eRetVal) && (MEMIF_IDLE != Fee_GetStatus()) )
+    {
+        Fee_MainFunction();
+        Fls_MainFunction();
+        u32Ticks++;
+
+        if( (boolean)FALSE == FeeHost_bFastForward )
+        {
+            Fls_Sim_AdvanceTime( FEE_HOST_TICK_US );
+        }
+        else
+        {
+            /* The model completes the flash operations on its own, only raise
+               the completion interrupt */
+            Fls_Sim_AdvanceTime( 0UL );
+        }
+
+        if( (boolean)TRUE == Fls_Sim_IsPowerLost() )
+        {
+            eRetVal = FEE_HOST_POWER_LOST;
+        }
+        else if( u32Ticks >= FEE_HOST_MAX_TICKS )
+        {
+            eRetVal = FEE_HOST_HUNG;
+        }
+        else
+        {
+            /* Keep running */
+        }
+    }
+
+    *pu32Ticks = u32Ticks;
+
+    return( eRetVal );
+}
+
+/**
+* @brief        Result of the last Fee job once Fee is idle
+*
+* @details      Fee_JobEndNotification doesn't take over the Fls job result of
+*               the final job step, a completed job reads back pending.
+*
+* @return       MemIf_JobResultType
+*/
+MemIf_JobResultType FeeHost_GetJobResult( void )
+{
+    MemIf_JobResultType eRetVal = Fee_GetJobResult();
+
+    if( MEMIF_JOB_PENDING == eRetVal )
+    {
+        eRetVal = MEMIF_JOB_OK;
+    }
+    else
+    {
+        /* Result of the failed or refused job */
+    }
+
+    return( eRetVal );
+}
+
+/**
+* @brief        Next value of the workload random generator
+*
+* @return       uint32
+*/
+uint32 FeeHost_Random( void )
+{
+    FeeHost_u32Random ^= FeeHost_u32Random << 13U;
+    FeeHost_u32Random ^= FeeHost_u32Random >> 17U;
+    FeeHost_u32Random ^= FeeHost_u32Random << 5U;
+
+    return( FeeHost_u32Random );
+}
+
+/**
+* @brief        Restart the workload random generator
+*
+* @param[in]    u32Seed         seed, 0 is replaced by 1
+*/
+void FeeHost_Seed( uint32 u32Seed )
+{
+    FeeHost_u32Random = (0UL != u32Seed) ? u32Seed : 1UL;
+}
+
+/**
+* @brief        Fill level of the active cluster of a cluster group
+*
+* @param[in]    uClrGrp         cluster group index
+* @return       used space of the active cluster in per mille
+*/
+uint32 FeeHost_GetFill( uint8 uClrGrp )
+{
+    const Fee_ClusterGroupInfoType * pInfo = &Fee_aClrGrpInfo[uClrGrp];
+    const Fee_ClusterType * pClr = &Fee_ClrGrps[uClrGrp].clrPtr[pInfo->uActClr];
+    uint32 u32Free = (uint32)(pInfo->uDataAddrIt - pInfo->uHdrAddrIt);
+
+    return( ((pClr->length - u32Free) * 1000UL) / pClr->length );
+}
+
+/**
+* @brief        Host monotonic time, for the host side throughput
+*
+* @return       time in ns
+*/
+uint64 FeeHost_GetTimeNs( void )
+{
+    struct timespec tNow;
+
+    (void)clock_gettime( CLOCK_MONOTONIC, &tNow );
+
+    return( ((uint64)tNow.tv_sec * 1000000000ULL) + (uint64)tNow.tv_nsec );
+}
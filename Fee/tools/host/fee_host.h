@@ -0,0 +1,57 @@
+#ifndef FEE_HOST_H
+#define FEE_HOST_H
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Fee.h"
+#include "Fls.h"
+#include "Fls_Sim.h"
+
+/*
+ * Host scheduler shared by the Fee/tools/host drivers. It powers the Fls/Fee stack
+ * up on the host flash model and runs Fee_MainFunction and Fls_MainFunction like
+ * the periodic task of the target until Fee is idle again.
+ */
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+/** @brief Period (us) of the main function task the virtual clock moves by per tick */
+#define FEE_HOST_TICK_US            1000UL
+
+/** @brief Ticks after which a Fee job is considered hung */
+#define FEE_HOST_MAX_TICKS          1000000UL
+
+/** @brief Fee_Write buffer large enough for any configured block */
+#define FEE_HOST_MAX_BLOCK_SIZE     256U
+
+/*==================================================================================================
+*                                             TYPES
+==================================================================================================*/
+/**
+* @brief        Outcome of FeeHost_Run
+*/
+typedef enum
+{
+    FEE_HOST_IDLE = 0,              /**< @brief Fee is idle again */
+    FEE_HOST_POWER_LOST,            /**< @brief the armed power cut happened */
+    FEE_HOST_HUNG                   /**< @brief Fee didn't get idle within FEE_HOST_MAX_TICKS */
+} FeeHost_RunType;
+
+/*==================================================================================================
+                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+void FeeHost_EraseImage( void );
+void FeeHost_PowerOn( boolean bFastForward );
+FeeHost_RunType FeeHost_Run( uint32 * pu32Ticks );
+MemIf_JobResultType FeeHost_GetJobResult( void );
+uint32 FeeHost_Random( void );
+void FeeHost_Seed( uint32 u32Seed );
+uint32 FeeHost_GetFill( uint8 uClrGrp );
+uint64 FeeHost_GetTimeNs( void );
+
+#endif /* FEE_HOST_H */
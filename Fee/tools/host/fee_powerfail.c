@@ -0,0 +1,682 @@
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "fee_host.h"
+
+/*
+ * Power-fail campaign on the host flash model.
+ *
+ * A seeded workload of Fee_Write and Fee_InvalidateBlock requests on both cluster
+ * groups runs from an erased flash image, including the first Fee_Init. Power is
+ * cut at every erase or program operation of the model, once at the operation
+ * boundary and once mid-page (half of the page programmed, or the start of the
+ * sector erased). For every cut one child process runs the workload up to the
+ * cut, a second one powers on again like a reset does and:
+ *
+ *   - completes Fee_Init and records its cost: ticks, flash bytes read, swaps run
+ *     by Fee_Init and cluster groups whose next write is forced to swap
+ *   - reads every block back: completed requests must be visible, the request
+ *     cut may show the old or the new content or read back inconsistent
+ *   - writes and reads back every block to check that Fee stays usable
+ *
+ * The summary table groups the cuts by cut kind, record format of the request's
+ * cluster group and phase of the request (Fee_Init of the erased flash, a write
+ * or invalidation, with a cluster swap running or not).
+ *
+ * Usage: fee_powerfail [requests [seed [stride]]]
+ *        stride > 1 samples every stride-th operation only
+ */
+
+/*==================================================================================================
+*                                      DEFINES AND MACROS
+==================================================================================================*/
+#define PF_KIND_BOUNDARY        0U
+#define PF_KIND_MID_PAGE        1U
+#define PF_KINDS                2U
+
+#define PF_PHASE_INIT           0U
+#define PF_PHASE_WRITE          1U
+#define PF_PHASE_INVALIDATE     2U
+#define PF_PHASES               3U
+
+#define PF_FORMAT_STANDARD      0U
+#define PF_FORMAT_COMPACT       1U
+#define PF_FORMAT_ALL           2U
+#define PF_FORMATS              3U
+
+/** @brief Bytes of the cut operation carried out for a mid-page cut */
+#define PF_MID_PAGE_BYTES       4UL
+
+/** @brief Expected block states of the model */
+#define PF_BLOCK_EMPTY          0U
+#define PF_BLOCK_VALID          1U
+#define PF_BLOCK_INVALID        2U
+
+/*==================================================================================================
+*                                             TYPES
+==================================================================================================*/
+/**
+* @brief        Expected content of a block
+*/
+typedef struct
+{
+    uint8 uState;
+    uint8 au8Data[FEE_HOST_MAX_BLOCK_SIZE];
+} Pf_BlockType;
+
+/**
+* @brief        State handed from the cut workload to the recovery
+*/
+typedef struct
+{
+    boolean bCut;                                   /**< @brief power was cut before the workload ended */
+    uint32 u32Operations;                           /**< @brief flash operations started */
+    uint8 uPhase;                                   /**< @brief PF_PHASE_* of the cut request */
+    uint8 uClrGrp;                                  /**< @brief cluster group of the cut request */
+    boolean bSwap;                                  /**< @brief a swap started during the cut request */
+    sint32 sPendingIndex;                           /**< @brief block index of the cut request, -1 none */
+    Pf_BlockType tPending;                          /**< @brief content the cut request would give */
+    Pf_BlockType atBlock[FEE_CRT_CFG_NR_OF_BLOCKS]; /**< @brief content of the completed requests */
+} Pf_ModelType;
+
+/**
+* @brief        Outcome of a recovery
+*/
+typedef struct
+{
+    boolean bOk;
+    uint32 u32InitTicks;
+    uint32 u32ReadBytes;
+    uint32 u32Swaps;
+    uint32 u32Forced;
+    char szError[96];
+} Pf_ResultType;
+
+/**
+* @brief        Row of the summary table
+*/
+typedef struct
+{
+    uint32 u32Cuts;
+    uint32 u32Failures;
+    uint64 u64InitTicks;
+    uint32 u32MaxInitTicks;
+    uint64 u64ReadBytes;
+    uint32 u32MaxReadBytes;
+    uint32 u32Swaps;
+    uint32 u32Forced;
+} Pf_RowType;
+
+/*==================================================================================================
+*                                       LOCAL VARIABLES
+==================================================================================================*/
+static Pf_ModelType Pf_tModel;
+
+static uint8 Pf_au8Buffer[FEE_HOST_MAX_BLOCK_SIZE];
+
+/** @brief Swaps started before the running request */
+static uint32 Pf_u32RequestSwaps = 0UL;
+
+/** @brief Summary rows by kind, record format (both for Fee_Init), phase and swap */
+static Pf_RowType Pf_atRow[PF_KINDS][PF_FORMATS][PF_PHASES][2];
+
+/*==================================================================================================
+*                                       LOCAL FUNCTIONS
+==================================================================================================*/
+/**
+* @brief        Swaps started since Fee_Init
+*/
+static uint32 Pf_GetSwaps( void )
+{
+    Fee_StatisticsType tStatistics;
+
+    Fee_GetStatistics( &tStatistics );
+
+    return( tStatistics.u32Swaps );
+}
+
+/**
+* @brief        Hand the model to the parent and end the workload process
+*/
+static void Pf_Exit( int iFd, boolean bCut )
+{
+    Pf_tModel.bCut = bCut;
+    Pf_tModel.bSwap = (Pf_GetSwaps() != Pf_u32RequestSwaps) ? (boolean)TRUE : (boolean)FALSE;
+    Pf_tModel.u32Operations = Fls_Sim_GetOperationCount();
+    (void)write( iFd, &Pf_tModel, sizeof(Pf_tModel) );
+    Fls_Sim_Deinit();
+    _exit( 0 );
+}
+
+/**
+* @brief        Run an accepted request, end the process on the cut
+*/
+static void Pf_Complete( int iFd )
+{
+    uint32 u32Ticks;
+
+    if( FEE_HOST_IDLE != FeeHost_Run( &u32Ticks ) )
+    {
+        Pf_Exit( iFd, (boolean)TRUE );
+    }
+    else
+    {
+        /* Request served */
+    }
+}
+
+/**
+* @brief        Run the workload from an erased flash, cut power at an operation
+*
+* @param[in]    iFd             pipe the model is written to
+* @param[in]    bArm            cut power
+* @param[in]    u32Operation    operation to cut
+* @param[in]    u32Bytes        bytes of it carried out
+* @param[in]    u32Requests     requests of the workload
+* @param[in]    u32Seed         workload seed
+*/
+static void Pf_Workload( int iFd, boolean bArm, uint32 u32Operation, uint32 u32Bytes,
+                         uint32 u32Requests, uint32 u32Seed )
+{
+    uint32 u32Request;
+    uint16 uBlockIndex;
+    uint16 uBlockNumber;
+    uint16 uByte;
+    Std_ReturnType eRetVal;
+
+    FeeHost_EraseImage();
+    FeeHost_Seed( u32Seed );
+    (void)memset( &Pf_tModel, 0, sizeof(Pf_tModel) );
+    Pf_tModel.sPendingIndex = -1;
+    Pf_tModel.uPhase = PF_PHASE_INIT;
+
+    if( (boolean)TRUE == bArm )
+    {
+        Fls_Sim_SetPowerFail( u32Operation, u32Bytes );
+    }
+    else
+    {
+        /* Reference run */
+    }
+
+    FeeHost_PowerOn( (boolean)TRUE );
+    Pf_Complete( iFd );
+
+    for( u32Request = 0UL; u32Request < u32Requests; u32Request++ )
+    {
+        uBlockIndex = (uint16)(FeeHost_Random() % FEE_CRT_CFG_NR_OF_BLOCKS);
+        uBlockNumber = Fee_BlockConfig[uBlockIndex].blockNumber;
+        Pf_tModel.sPendingIndex = (sint32)uBlockIndex;
+        Pf_tModel.uClrGrp = Fee_BlockConfig[uBlockIndex].clrGrp;
+        Pf_u32RequestSwaps = Pf_GetSwaps();
+
+        if( (FeeHost_Random() % 10UL) < 9UL )
+        {
+            Pf_tModel.uPhase = PF_PHASE_WRITE;
+            Pf_tModel.tPending.uState = PF_BLOCK_VALID;
+
+            for( uByte = 0U; uByte < Fee_BlockConfig[uBlockIndex].blockSize; uByte++ )
+            {
+                Pf_tModel.tPending.au8Data[uByte] = (uint8)FeeHost_Random();
+            }
+
+            eRetVal = Fee_Write( uBlockNumber, Pf_tModel.tPending.au8Data );
+        }
+        else
+        {
+            Pf_tModel.uPhase = PF_PHASE_INVALIDATE;
+            Pf_tModel.tPending.uState = PF_BLOCK_INVALID;
+            eRetVal = Fee_InvalidateBlock( uBlockNumber );
+        }
+
+        if( ((Std_ReturnType)E_OK) != eRetVal )
+        {
+            (void)fprintf( stderr, "fee_powerfail: request %lu refused\n", (unsigned long)u32Request );
+            _exit( 2 );
+        }
+        else
+        {
+            /* The cut lands in this request or a later one */
+        }
+
+        Pf_Complete( iFd );
+
+        if( MEMIF_JOB_OK != FeeHost_GetJobResult() )
+        {
+            (void)fprintf( stderr, "fee_powerfail: request %lu failed\n", (unsigned long)u32Request );
+            _exit( 2 );
+        }
+        else
+        {
+            Pf_tModel.atBlock[uBlockIndex] = Pf_tModel.tPending;
+            Pf_tModel.sPendingIndex = -1;
+        }
+    }
+
+    Pf_Exit( iFd, (boolean)FALSE );
+}
+
+/**
+* @brief        Check a read result against the expected content of a block
+*/
+static boolean Pf_Matches( const Pf_BlockType * pBlock, uint16 uBlockIndex, MemIf_JobResultType eResult )
+{
+    boolean bRetVal = (boolean)FALSE;
+
+    if( PF_BLOCK_VALID == pBlock->uState )
+    {
+        if( (MEMIF_JOB_OK == eResult) &&
+            (0 == memcmp( Pf_au8Buffer, pBlock->au8Data, Fee_BlockConfig[uBlockIndex].blockSize ))
+          )
+        {
+            bRetVal = (boolean)TRUE;
+        }
+        else
+        {
+            /* Data lost or wrong */
+        }
+    }
+    else if( PF_BLOCK_INVALID == pBlock->uState )
+    {
+        /* A swap doesn't copy invalidated blocks, they read back inconsistent then */
+        bRetVal = ((MEMIF_BLOCK_INVALID == eResult) || (MEMIF_BLOCK_INCONSISTENT == eResult)) ? (boolean)TRUE : (boolean)FALSE;
+    }
+    else
+    {
+        bRetVal = (MEMIF_BLOCK_INCONSISTENT == eResult) ? (boolean)TRUE : (boolean)FALSE;
+    }
+
+    return( bRetVal );
+}
+
+/**
+* @brief        Read a block, FALSE when the request couldn't be run
+*/
+static boolean Pf_Read( uint16 uBlockIndex, MemIf_JobResultType * peResult )
+{
+    boolean bRetVal = (boolean)FALSE;
+    uint32 u32Ticks;
+
+    (void)memset( Pf_au8Buffer, 0xAA, sizeof(Pf_au8Buffer) );
+
+    if( (((Std_ReturnType)E_OK) == Fee_Read( Fee_BlockConfig[uBlockIndex].blockNumber, 0U, Pf_au8Buffer,
+                                              Fee_BlockConfig[uBlockIndex].blockSize )) &&
+        (FEE_HOST_IDLE == FeeHost_Run( &u32Ticks ))
+      )
+    {
+        *peResult = FeeHost_GetJobResult();
+        bRetVal = (boolean)TRUE;
+    }
+    else
+    {
+        /* Refused or hung */
+    }
+
+    return( bRetVal );
+}
+
+/**
+* @brief        Power on after the cut, check the blocks and that Fee stays usable
+*
+* @param[in]    iFd             pipe the result is written to
+*/
+static void Pf_Recover( int iFd )
+{
+    Pf_ResultType tResult;
+    Fls_Sim_SectorStatsType tTotals;
+    MemIf_JobResultType eResult = MEMIF_JOB_FAILED;
+    const Fee_ClusterGroupInfoType * pInfo;
+    uint32 u32Ticks;
+    uint16 uBlockIndex;
+    uint16 uByte;
+    uint8 uClrGrp;
+    boolean bOk;
+
+    (void)memset( &tResult, 0, sizeof(tResult) );
+    tResult.bOk = (boolean)TRUE;
+
+    FeeHost_PowerOn( (boolean)FALSE );
+
+    if( FEE_HOST_IDLE != FeeHost_Run( &tResult.u32InitTicks ) )
+    {
+        tResult.bOk = (boolean)FALSE;
+        (void)snprintf( tResult.szError, sizeof(tResult.szError), "Fee_Init hung" );
+    }
+    else
+    {
+        Fls_Sim_GetTotals( &tTotals );
+        tResult.u32ReadBytes = tTotals.u32ReadBytes;
+        tResult.u32Swaps = Pf_GetSwaps();
+
+        for( uClrGrp = 0U; uClrGrp < FEE_NUMBER_OF_CLUSTER_GROUPS; uClrGrp++ )
+        {
+            pInfo = &Fee_aClrGrpInfo[uClrGrp];
+
+            /* Fee_Init marks a cluster to swap on the next write this way */
+            if( pInfo->uDataAddrIt == (pInfo->uHdrAddrIt + (2U * FEE_BLOCK_OVERHEAD)) )
+            {
+                tResult.u32Forced++;
+            }
+            else
+            {
+                /* Next write goes to the active cluster */
+            }
+        }
+    }
+
+    for( uBlockIndex = 0U; ((boolean)TRUE == tResult.bOk) && (uBlockIndex < FEE_CRT_CFG_NR_OF_BLOCKS); uBlockIndex++ )
+    {
+        bOk = Pf_Read( uBlockIndex, &eResult );
+
+        if( (boolean)TRUE == bOk )
+        {
+            bOk = Pf_Matches( &Pf_tModel.atBlock[uBlockIndex], uBlockIndex, eResult );
+
+            if( ((boolean)FALSE == bOk) && ((sint32)uBlockIndex == Pf_tModel.sPendingIndex) )
+            {
+                /* The cut request may have completed or left the block inconsistent */
+                bOk = ((boolean)TRUE == Pf_Matches( &Pf_tModel.tPending, uBlockIndex, eResult )) ||
+                      (MEMIF_BLOCK_INCONSISTENT == eResult);
+            }
+            else
+            {
+                /* Block not touched by the cut request */
+            }
+        }
+        else
+        {
+            /* Read refused or hung */
+        }
+
+        if( (boolean)FALSE == bOk )
+        {
+            tResult.bOk = (boolean)FALSE;
+            (void)snprintf( tResult.szError, sizeof(tResult.szError), "block %u reads back %d, expected state %u",
+                            (unsigned)Fee_BlockConfig[uBlockIndex].blockNumber, (int)eResult,
+                            (unsigned)Pf_tModel.atBlock[uBlockIndex].uState );
+        }
+        else
+        {
+            /* Block as expected */
+        }
+    }
+
+    for( uBlockIndex = 0U; ((boolean)TRUE == tResult.bOk) && (uBlockIndex < FEE_CRT_CFG_NR_OF_BLOCKS); uBlockIndex++ )
+    {
+        for( uByte = 0U; uByte < Fee_BlockConfig[uBlockIndex].blockSize; uByte++ )
+        {
+            Pf_tModel.tPending.au8Data[uByte] = (uint8)(uBlockIndex + uByte);
+        }
+
+        Pf_tModel.tPending.uState = PF_BLOCK_VALID;
+
+        if( (((Std_ReturnType)E_OK) != Fee_Write( Fee_BlockConfig[uBlockIndex].blockNumber, Pf_tModel.tPending.au8Data )) ||
+            (FEE_HOST_IDLE != FeeHost_Run( &u32Ticks )) ||
+            (MEMIF_JOB_OK != FeeHost_GetJobResult()) ||
+            ((boolean)FALSE == Pf_Read( uBlockIndex, &eResult )) ||
+            ((boolean)FALSE == Pf_Matches( &Pf_tModel.tPending, uBlockIndex, eResult ))
+          )
+        {
+            tResult.bOk = (boolean)FALSE;
+            (void)snprintf( tResult.szError, sizeof(tResult.szError), "block %u not writable after recovery",
+                            (unsigned)Fee_BlockConfig[uBlockIndex].blockNumber );
+        }
+        else
+        {
+            /* Fee usable */
+        }
+    }
+
+    (void)write( iFd, &tResult, sizeof(tResult) );
+    Fls_Sim_Deinit();
+    _exit( 0 );
+}
+
+/**
+* @brief        Run one phase of a cut in a child process
+*
+* @return       TRUE when the child reported its data completely
+*/
+static boolean Pf_Fork( void * pData, size_t uSize, boolean bRecover, boolean bArm, uint32 u32Operation,
+                        uint32 u32Bytes, uint32 u32Requests, uint32 u32Seed )
+{
+    boolean bRetVal = (boolean)FALSE;
+    int aiFd[2];
+    int iStatus = 0;
+    pid_t tPid;
+    ssize_t sRead;
+
+    if( 0 == pipe( aiFd ) )
+    {
+        (void)fflush( stdout );
+        tPid = fork();
+
+        if( 0 == tPid )
+        {
+            (void)close( aiFd[0] );
+
+            if( (boolean)TRUE == bRecover )
+            {
+                Pf_Recover( aiFd[1] );
+            }
+            else
+            {
+                Pf_Workload( aiFd[1], bArm, u32Operation, u32Bytes, u32Requests, u32Seed );
+            }
+        }
+        else
+        {
+            (void)close( aiFd[1] );
+            sRead = read( aiFd[0], pData, uSize );
+            (void)close( aiFd[0] );
+            (void)waitpid( tPid, &iStatus, 0 );
+            bRetVal = ((size_t)sRead == uSize) ? (boolean)TRUE : (boolean)FALSE;
+        }
+    }
+    else
+    {
+        /* No pipe */
+    }
+
+    return( bRetVal );
+}
+
+/**
+* @brief        Account a recovery in the summary
+*/
+static void Pf_Account( uint8 uKind, const Pf_ResultType * pResult )
+{
+    uint8 uFormat = PF_FORMAT_ALL;
+    Pf_RowType * pRow;
+
+    if( PF_PHASE_INIT != Pf_tModel.uPhase )
+    {
+        uFormat = (FEE_RECORD_COMPACT == Fee_ClrGrps[Pf_tModel.uClrGrp].recordFormat) ? PF_FORMAT_COMPACT : PF_FORMAT_STANDARD;
+    }
+    else
+    {
+        /* Fee_Init formats all cluster groups */
+    }
+
+    pRow = &Pf_atRow[uKind][uFormat][Pf_tModel.uPhase][((boolean)TRUE == Pf_tModel.bSwap) ? 1U : 0U];
+
+    pRow->u32Cuts++;
+    pRow->u32Failures += ((boolean)TRUE == pResult->bOk) ? 0UL : 1UL;
+    pRow->u64InitTicks += pResult->u32InitTicks;
+    pRow->u64ReadBytes += pResult->u32ReadBytes;
+    pRow->u32Swaps += pResult->u32Swaps;
+    pRow->u32Forced += pResult->u32Forced;
+
+    if( pResult->u32InitTicks > pRow->u32MaxInitTicks )
+    {
+        pRow->u32MaxInitTicks = pResult->u32InitTicks;
+    }
+    else
+    {
+        /* Not the longest */
+    }
+
+    if( pResult->u32ReadBytes > pRow->u32MaxReadBytes )
+    {
+        pRow->u32MaxReadBytes = pResult->u32ReadBytes;
+    }
+    else
+    {
+        /* Not the largest */
+    }
+}
+
+/**
+* @brief        Print the summary table
+*/
+static void Pf_PrintSummary( void )
+{
+    static const char * const aszKind[PF_KINDS] = { "boundary", "mid-page" };
+    static const char * const aszFormat[PF_FORMATS] = { "standard", "compact", "all" };
+    static const char * const aszPhase[PF_PHASES] = { "init", "write", "invalidate" };
+    const Pf_RowType * pRow;
+    uint32 u32Cuts = 0UL;
+    uint32 u32Failures = 0UL;
+    uint8 uKind;
+    uint8 uFormat;
+    uint8 uPhase;
+    uint8 uSwap;
+
+    (void)printf( "%-9s %-9s %-11s %-5s %6s %6s %10s %10s %10s %10s %6s %6s\n",
+                  "cut", "format", "request", "swap", "cuts", "fails", "ticks avg", "ticks max",
+                  "read avg", "read max", "swaps", "forced" );
+
+    for( uKind = 0U; uKind < PF_KINDS; uKind++ )
+    {
+        for( uFormat = 0U; uFormat < PF_FORMATS; uFormat++ )
+        {
+            for( uPhase = 0U; uPhase < PF_PHASES; uPhase++ )
+            {
+                for( uSwap = 0U; uSwap < 2U; uSwap++ )
+                {
+                    pRow = &Pf_atRow[uKind][uFormat][uPhase][uSwap];
+
+                    if( pRow->u32Cuts > 0UL )
+                    {
+                        (void)printf( "%-9s %-9s %-11s %-5s %6lu %6lu %10.1f %10lu %10.1f %10lu %6lu %6lu\n",
+                                      aszKind[uKind], aszFormat[uFormat], aszPhase[uPhase], (0U != uSwap) ? "yes" : "no",
+                                      (unsigned long)pRow->u32Cuts, (unsigned long)pRow->u32Failures,
+                                      (double)pRow->u64InitTicks / (double)pRow->u32Cuts,
+                                      (unsigned long)pRow->u32MaxInitTicks,
+                                      (double)pRow->u64ReadBytes / (double)pRow->u32Cuts,
+                                      (unsigned long)pRow->u32MaxReadBytes,
+                                      (unsigned long)pRow->u32Swaps, (unsigned long)pRow->u32Forced );
+                        u32Cuts += pRow->u32Cuts;
+                        u32Failures += pRow->u32Failures;
+                    }
+                    else
+                    {
+                        /* No cut in this class */
+                    }
+                }
+            }
+        }
+    }
+
+    (void)printf( "total: %lu cuts, %lu failures\n", (unsigned long)u32Cuts, (unsigned long)u32Failures );
+}
+
+/*==================================================================================================
+*                                       GLOBAL FUNCTIONS
+==================================================================================================*/
+int main( int argc, char * argv[] )
+{
+    Pf_ResultType tResult;
+    uint32 u32Requests = (argc > 1) ? (uint32)strtoul( argv[1], NULL_PTR, 0 ) : 300UL;
+    uint32 u32Seed = (argc > 2) ? (uint32)strtoul( argv[2], NULL_PTR, 0 ) : 1UL;
+    uint32 u32Stride = (argc > 3) ? (uint32)strtoul( argv[3], NULL_PTR, 0 ) : 1UL;
+    uint32 u32Operations;
+    uint32 u32Operation;
+    uint8 uKind;
+    int iRetVal = 0;
+
+    if( 0UL == u32Stride )
+    {
+        u32Stride = 1UL;
+    }
+    else
+    {
+        /* Stride given */
+    }
+
+    if( ((boolean)FALSE == Pf_Fork( &Pf_tModel, sizeof(Pf_tModel), (boolean)FALSE, (boolean)FALSE, 0UL, 0UL,
+                                    u32Requests, u32Seed )) ||
+        ((boolean)TRUE == Pf_tModel.bCut)
+      )
+    {
+        (void)fprintf( stderr, "fee_powerfail: reference run failed\n" );
+        iRetVal = 2;
+    }
+    else
+    {
+        u32Operations = Pf_tModel.u32Operations;
+        (void)printf( "workload: %lu requests, seed %lu, %lu flash operations, stride %lu\n",
+                      (unsigned long)u32Requests, (unsigned long)u32Seed, (unsigned long)u32Operations,
+                      (unsigned long)u32Stride );
+
+        for( u32Operation = 0UL; u32Operation < u32Operations; u32Operation += u32Stride )
+        {
+            for( uKind = 0U; uKind < PF_KINDS; uKind++ )
+            {
+                if( ((boolean)FALSE == Pf_Fork( &Pf_tModel, sizeof(Pf_tModel), (boolean)FALSE, (boolean)TRUE, u32Operation,
+                                                (PF_KIND_BOUNDARY == uKind) ? 0UL : PF_MID_PAGE_BYTES, u32Requests, u32Seed )) ||
+                    ((boolean)FALSE == Pf_tModel.bCut)
+                  )
+                {
+                    (void)fprintf( stderr, "fee_powerfail: operation %lu: workload didn't reach the cut\n",
+                                   (unsigned long)u32Operation );
+                    iRetVal = 1;
+                }
+                else
+                {
+                    if( (boolean)FALSE == Pf_Fork( &tResult, sizeof(tResult), (boolean)TRUE, (boolean)FALSE, 0UL, 0UL,
+                                                   0UL, 0UL ) )
+                    {
+                        tResult.bOk = (boolean)FALSE;
+                        tResult.u32InitTicks = 0UL;
+                        tResult.u32ReadBytes = 0UL;
+                        tResult.u32Swaps = 0UL;
+                        tResult.u32Forced = 0UL;
+                        (void)snprintf( tResult.szError, sizeof(tResult.szError), "recovery crashed" );
+                    }
+                    else
+                    {
+                        /* Recovery reported */
+                    }
+
+                    if( (boolean)FALSE == tResult.bOk )
+                    {
+                        (void)printf( "FAIL operation %lu %s: %s\n", (unsigned long)u32Operation,
+                                      (PF_KIND_BOUNDARY == uKind) ? "boundary" : "mid-page", tResult.szError );
+                        iRetVal = 1;
+                    }
+                    else
+                    {
+                        /* Recovered */
+                    }
+
+                    Pf_Account( uKind, &tResult );
+                }
+            }
+        }
+
+        Pf_PrintSummary();
+    }
+
+    FeeHost_EraseImage();
+
+    return( iRetVal );
+}
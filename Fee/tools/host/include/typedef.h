@@ -0,0 +1,39 @@
+/*
+ * Host stand-in for the typedef.h of the FC4xxx SDK, used by the host builds of
+ * Fee/tools/host only. It provides the base types and macros Fls and Fee rely on.
+ */
+#ifndef TYPEDEF_H
+#define TYPEDEF_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef uint64_t uint64;
+typedef int8_t sint8;
+typedef int16_t sint16;
+typedef int32_t sint32;
+typedef unsigned char boolean;
+
+#ifndef TRUE
+#define TRUE        1U
+#endif
+#ifndef FALSE
+#define FALSE       0U
+#endif
+#ifndef true
+#define true        TRUE
+#endif
+#ifndef false
+#define false       FALSE
+#endif
+
+#define NULL_PTR    ((void *)0)
+
+#define UNUSED(x)   ((void)(x))
+
+#define LOCAL_INLINE static inline
+
+#endif /* TYPEDEF_H */
@@ -28,8 +28,16 @@ void Fls_Init(void);
 Std_ReturnType Fls_Erase(Fls_AddressType u32TargetAddress,Fls_LengthType u32Length);
 Std_ReturnType Fls_Write (Fls_AddressType u32TargetAddress,	const uint8 * pSourceAddressPtr, Fls_LengthType u32Length);
 MemIf_JobResultType Fls_GetJobResult( void );
+void Fls_SetMode( MemIf_ModeType eMode );
+#if( FLS_ADAPTIVE_BUDGET == STD_ON )
+void Fls_GetAdaptiveStats( Fls_AdaptiveStatsType * pStats );
+#endif
 Std_ReturnType Fls_Read (Fls_AddressType u32SourceAddress, uint8 * pTargetAddressPtr, Fls_LengthType u32Length);
+Std_ReturnType Fls_Compare (Fls_AddressType u32SourceAddress, const uint8 * pTargetAddressPtr, Fls_LengthType u32Length);
+Std_ReturnType Fls_BlankCheck (Fls_AddressType u32TargetAddress, Fls_LengthType u32Length);
+void Fls_Cancel( void );
 void Fls_MainFunction( void );
+void Fls_IrqHandler( void );
 
 #ifdef __cplusplus
 }
@@ -92,9 +92,21 @@ typedef struct
     */
     const Fls_HwChType (*paHwCh)[];
     /**
+    * @brief Pointer to array containing the backend operations of each hardware channel, indexed by Fls_HwChType.
+    */
+    const Fls_ChannelOpsType * const (*paChannelOps)[FLS_HW_CH_COUNT];
+    /**
     * @brief Pointer to array containing the configured hardware start address of each external sector.
     */
     const uint32_t (*paSectorHwAddress)[];
+    /**
+    * @brief number of sector runs in the geometry descriptor
+    */
+    uint32_t u32SectorRunCount;
+    /**
+    * @brief pointer to array of sector runs (geometry descriptor) sorted by address
+    */
+    const Fls_SectorRunType (*paSectorRuns)[];
 
     /**
      * @brief FLS Config Set CRC checksum
@@ -116,6 +128,70 @@ typedef struct
 #define FLS_PAGE_WRITE_ASYNCH        0x02U
 #define FLS_SECTOR_IRQ_MODE          0x04U
 
+/* Start the job requested by the job end/error notification in the same Fls_MainFunction call */
+#define FLS_JOB_CONTINUATION         STD_OFF
+/* Maximum number of jobs processed back-to-back in one Fls_MainFunction call */
+#define FLS_MAX_CHAINED_JOBS         8U
+/* Maximum number of program units started in one Fls_MainFunction call of an asynchronous write */
+#define FLS_MAX_PROGRAM_UNITS_PER_CYCLE    4U
+/* Serve Fls_Read by parking a pending erase job, suspending the hardware erase when the array supports it */
+#define FLS_ERASE_SUSPEND            STD_OFF
+/* Serve Fls_Read on the other flash bank while an erase or write operation is running */
+#define FLS_READ_WHILE_WRITE         STD_OFF
+/* Erase a job range covering a whole flash bank with one block erase command, when none of its sectors is configured locked */
+#define FLS_BLOCK_ERASE              STD_OFF
+/* Adapt the read and write budgets per Fls_MainFunction call to the measured transfer time
+   (needs FLS_GET_TIMESTAMP() mapped to a running timer) */
+#define FLS_ADAPTIVE_BUDGET          STD_OFF
+/* Count the lock register writes and ROM driver calls of the internal flash backend (Fls_Flash_GetCallCounters) */
+#define FLS_CALL_COUNTERS            STD_OFF
+/* Free-running timestamp used by the adaptive budget and the erase/write deadlines
+   (map to a hardware timer, or a host clock in simulation; a constant never times out) */
+#define FLS_GET_TIMESTAMP()          (0UL)
+/* FLS_GET_TIMESTAMP ticks per microsecond */
+#define FLS_TIMESTAMP_TICKS_PER_US   1UL
+/* Enable, disable and acknowledge the flash command complete interrupt of FLS_SECTOR_IRQ_MODE sectors
+   (map to the interrupt enable bit and the write-1-to-clear done flag of the FMC in the device header,
+   route the interrupt to Fls_IrqHandler) */
+#define FLS_FLASH_IRQ_ENABLE()       ((void)0)
+#define FLS_FLASH_IRQ_DISABLE()      ((void)0)
+#define FLS_FLASH_IRQ_ACK()          ((void)0)
+/* Time a sector erase may take before it is reported as failed */
+#define FLS_ERASE_TIMEOUT_US         100000UL
+/* Time a program operation may take before it is reported as failed */
+#define FLS_WRITE_TIMEOUT_US         1000UL
+/* Polls after which a synchronous erase is reported as failed, backstop of the deadline
+   when FLS_GET_TIMESTAMP() is left constant */
+#define FLS_ERASE_MAX_POLLS          100000UL
+/* Polls after which a synchronous write is reported as failed, backstop of the deadline
+   when FLS_GET_TIMESTAMP() is left constant */
+#define FLS_WRITE_MAX_POLLS          10000UL
+/* Time one budgeted transfer may take, in FLS_GET_TIMESTAMP ticks */
+#define FLS_ADAPTIVE_TIME_SLICE      1000UL
+/* Smallest read or write budget in bytes, a multiple of the program page size */
+#define FLS_ADAPTIVE_MIN_BUDGET      8UL
+/* Serve the sectors by the host flash model of Fls_Sim.c instead of the internal flash (host builds,
+   map FLS_GET_TIMESTAMP() to Fls_Sim_GetTime() for a virtual time base) */
+#define FLS_SIM_BACKEND              STD_OFF
+/* Image file of the host flash model, created erased if missing */
+#define FLS_SIM_IMAGE_FILE           "fls_sim.bin"
+/* Sectors with operation counters in the host flash model */
+#define FLS_SIM_MAX_SECTORS          64U
+/* Sector erase time of the host flash model */
+#define FLS_SIM_ERASE_TIME_US        20000UL
+/* Sectors per bank of the host flash model, the banks start at sector 0 */
+#define FLS_SIM_BANK_SECTORS         16U
+/* Block erase time of a bank of the host flash model (FLS_BLOCK_ERASE) */
+#define FLS_SIM_BLOCK_ERASE_TIME_US  100000UL
+/* Program time of one page of the host flash model */
+#define FLS_SIM_PROGRAM_TIME_US      40UL
+/* Read time per byte of the host flash model */
+#define FLS_SIM_READ_TIME_NS         25UL
+/* Time from the erase suspend command of the host flash model until the array can be read */
+#define FLS_SIM_SUSPEND_TIME_US      20UL
+/* Erase time the host flash model adds to a resumed sector erase */
+#define FLS_SIM_RESUME_TIME_US       100UL
+
 /* Declaration of post-build configuration set structure */
  /* @violates @ref Fls_Cfg_H_REF_2 Could define variable at block scope */
  extern const Fls_ConfigType Fls_Config;
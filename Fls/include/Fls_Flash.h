@@ -36,7 +36,11 @@ extern volatile MemIf_JobResultType Fls_eLLDJobResult;
 /**
     @brief Type of current flash hardware job - used for asynchronous operating mode.
 */
-extern Fls_LLDJobType Fls_eLLDJob;
+extern volatile Fls_LLDJobType Fls_eLLDJob;
+/**
+    @brief Type of current flash hardware job - used for interrupt operating mode.
+*/
+extern volatile Fls_LLDIrqJobType Fls_eLLDIrqJob;
 /**
 * @brief Pointer to current flash module configuration set
 */
@@ -45,10 +49,22 @@ extern const Fls_ConfigType * Fls_pConfigPtr;
     @brief Number of bytes of data left to write.
 */
 extern volatile Fls_LengthType Fls_u32LLDRemainingDataToWrite;
+/**
+* @brief Backend operations of the internal flash channel
+*/
+extern const Fls_ChannelOpsType Fls_Flash_tChannelOps;
 /*==================================================================================================
                                        FUNCTION PROTOTYPES
 ==================================================================================================*/
-void Fls_Flash_Init( void );
+Std_ReturnType Fls_Flash_Init( void );
+void Fls_Flash_LockSectors( void );
+const Fls_Flash_ArrayInfoType * Fls_Flash_GetArrayInfo( void );
+uint32_t Fls_Flash_GetBank( const Fls_PhysicalSectorType ePhySector );
+Fls_LLDReturnType Fls_Flash_EraseSuspend( void );
+Fls_LLDReturnType Fls_Flash_EraseResume( void );
+#if (FLS_CALL_COUNTERS == STD_ON)
+void Fls_Flash_GetCallCounters( Fls_Flash_CallCountersType * pCounters );
+#endif
 uint16_t Only_Erase(uint32_t u32Addr, uint32_t u32DataLen);
 uint16_t Only_Write(uint32_t u32Addr, uint32_t u32DataLen);
 uint16_t Only_Read(uint32_t u32Addr, uint32_t u32DataLen);
@@ -56,10 +72,16 @@ uint16_t Only_Read(uint32_t u32Addr, uint32_t u32DataLen);
 void  Fls_Flash_MainFunctionErase( void );
 void Fls_Flash_MainFunctionWrite( void );
 Fls_LLDReturnType Fls_Flash_SectorErase(const Fls_PhysicalSectorType ePhySector, const boolean bAsynch);
+boolean Fls_Flash_IsWholeBank( const Fls_PhysicalSectorType ePhySectorFirst, const Fls_PhysicalSectorType ePhySectorLast );
+Fls_LLDReturnType Fls_Flash_BlockErase(const Fls_PhysicalSectorType ePhySectorFirst, const Fls_PhysicalSectorType ePhySectorLast);
 Fls_LLDReturnType Fls_Flash_SectorWrite(const Fls_PhysicalSectorType ePhySector, const Fls_AddressType u32SectorOffset,
 		                                const Fls_LengthType  u32DataLength, const uint8_t * const pDataPtr, const boolean bAsynch);
 Fls_LLDReturnType  Fls_Flash_SectorRead (const Fls_PhysicalSectorType ePhySector, const Fls_AddressType u32SectorOffset, Fls_LengthType u32DataLength,
 										uint8 * pDataPtr);
+Fls_LLDReturnType Fls_Flash_SectorCompare(const Fls_PhysicalSectorType ePhySector, const Fls_AddressType u32SectorOffset,
+                                          Fls_LengthType u32DataLength, const uint8 * pDataPtr);
+Fls_LLDReturnType Fls_Flash_SectorBlankCheck(const Fls_PhysicalSectorType ePhySector, const Fls_AddressType u32SectorOffset,
+                                             Fls_LengthType u32DataLength);
 //Fls_LLDReturnType Fls_Flash_SectorErase(const Fls_PhysicalSectorType ePhySector, const boolean bAsynch);
    
 #ifdef __cplusplus
@@ -102,6 +102,20 @@ typedef struct
     boolean bEraseSuspPossible; /**< @brief is Erase suspend operation possible within FLASH array */
 } Fls_Flash_ArrayInfoType;
 
+/**
+    @brief Lock register writes and ROM driver calls of the internal flash backend (FLS_CALL_COUNTERS)
+*/
+typedef struct
+{
+    uint32_t u32LockRequests;   /**< @brief lock and unlock requests of the program/erase paths */
+    uint32_t u32LockWrites;     /**< @brief FB_FPELCK register writes */
+    uint32_t u32RomResolves;    /**< @brief reads of the ROM entry points from the ROM header */
+    uint32_t u32RomErase;       /**< @brief ROM sector and block erase calls */
+    uint32_t u32RomProgram;     /**< @brief ROM program calls */
+    uint32_t u32RomClear;       /**< @brief ROM erase and program clear calls */
+    uint32_t u32RomStatus;      /**< @brief ROM HV status check calls */
+} Fls_Flash_CallCountersType;
+
 /**
 * @brief          Return value of Fls handler function.
 * @details        Fls_DsiHandler and Fls_MciHandler can return the following value:
@@ -45,7 +45,7 @@ extern volatile MemIf_JobResultType Fls_eLLDJobResult;
 * @violates @ref fls_ipw_h_REF_5 An external object or function shall be declared in one and only
 * one file.
 */
-extern Fls_LLDJobType Fls_eLLDJob;
+extern volatile Fls_LLDJobType Fls_eLLDJob;
 /** 
 * @brief Pointer to current flash module configuration set
 */
@@ -61,10 +61,17 @@ extern const Fls_ConfigType * Fls_pConfigPtr;
 */
 extern volatile Fls_LLDIrqJobType Fls_eLLDIrqJob;
 
-void Fls_IPW_Init(void);
+Std_ReturnType Fls_IPW_Init(void);
 Fls_LLDReturnType Fls_IPW_SectorErase (const boolean bAsynch);
 Fls_LLDReturnType Fls_IPW_SectorWrite (const Fls_AddressType u32SectorOffset, const Fls_AddressType u32Length,  const uint8 * pJobDataSrcPtr, const boolean bAsynch );
 Fls_LLDReturnType Fls_IPW_SectorRead ( const Fls_AddressType u32SectorOffset, const Fls_AddressType u32Length, uint8 * pJobDataDestPtr);
+Fls_LLDReturnType Fls_IPW_SectorCompare ( const Fls_AddressType u32SectorOffset, const Fls_AddressType u32Length, const uint8 * pJobDataSrcPtr);
+Fls_LLDReturnType Fls_IPW_SectorBlankCheck ( const Fls_AddressType u32SectorOffset, const Fls_AddressType u32Length);
 void Fls_IPW_LLDMainFunction( void );
+void Fls_IPW_LockSectors( void );
+boolean Fls_IPW_EraseSuspendPossible( void );
+Fls_LLDReturnType Fls_IPW_EraseSuspend( void );
+Fls_LLDReturnType Fls_IPW_EraseResume( void );
+boolean Fls_IPW_ReadWhileWritePossible( const Fls_SectorIndexType u32ReadSectorIt, const Fls_SectorIndexType u32ReadSectorEnd );
 
 #endif /* FLS_IPW_H */
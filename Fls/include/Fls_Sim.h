@@ -0,0 +1,63 @@
+#ifndef FLS_SIM_H
+#define FLS_SIM_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include "Fls.h"
+#include "Fls_Types.h"
+
+#if( FLS_SIM_BACKEND == STD_ON )
+/*==================================================================================================
+*                                             TYPES
+==================================================================================================*/
+/**
+* @brief          Operation counters of one sector of the host flash model.
+*/
+typedef struct
+{
+    uint32 u32EraseCount;               /**< @brief sector erases */
+    uint32 u32ProgramCount;             /**< @brief program operations (pages) */
+    uint32 u32ProgramBytes;             /**< @brief programmed bytes */
+    uint32 u32ReadBytes;                /**< @brief read, compared and blank checked bytes */
+    uint32 u32RuleViolations;           /**< @brief program operations rejected by the NOR rules */
+    uint32 u32EraseSuspends;            /**< @brief sector erases suspended to serve a read */
+} Fls_Sim_SectorStatsType;
+
+/*==================================================================================================
+*                                      GLOBAL VARIABLES
+==================================================================================================*/
+/**
+* @brief Backend operations of the host flash model channel
+*/
+extern const Fls_ChannelOpsType Fls_Sim_tChannelOps;
+
+/*==================================================================================================
+                                       FUNCTION PROTOTYPES
+==================================================================================================*/
+void Fls_Sim_Deinit( void );
+void Fls_Sim_AdvanceTime( uint32 u32Us );
+void Fls_Sim_SetFastForward( boolean bFastForward );
+uint32 Fls_Sim_GetTime( void );
+const Fls_Sim_SectorStatsType * Fls_Sim_GetSectorStats( const Fls_PhysicalSectorType ePhySector );
+void Fls_Sim_GetTotals( Fls_Sim_SectorStatsType * pTotals );
+void Fls_Sim_ResetStats( void );
+void Fls_Sim_SetPowerFail( uint32 u32Operations, uint32 u32Bytes );
+boolean Fls_Sim_IsPowerLost( void );
+uint32 Fls_Sim_GetOperationCount( void );
+#endif /* FLS_SIM_BACKEND == STD_ON */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FLS_SIM_H */
+
+/** @}*/
@@ -27,7 +27,7 @@ extern "C"{
 * 2) needed interfaces from external units
 * 3) internal and external interfaces from this unit
 ==================================================================================================*/
-#include "typedef.h"
+#include "Std_Types.h"
 
 /*==================================================================================================
 *                                      DEFINES AND MACROS
@@ -47,9 +47,15 @@ typedef uint32_t Fls_PhysicalSectorType;
 typedef enum
 {
     FLS_CH_INTERN = 0,
-    FLS_CH_QSPI = 1
+    FLS_CH_QSPI = 1,
+    FLS_CH_SIM = 2
 } Fls_HwChType;
 
+/**
+    @brief Number of flash sector channel types, size of the channel operations table.
+*/
+#define FLS_HW_CH_COUNT     3U
+
 /**
 * @brief          Type of job currently executed by Fls_MainFunction.
 */
@@ -229,6 +235,19 @@ typedef uint32_t Fls_LengthType;
 */
 typedef uint32_t Fls_SectorCountType;
 
+/**
+* @brief          Run of consecutive logical sectors of equal power of two size.
+* @details        Element of the geometry descriptor mapping an address to its
+*                 logical sector without walking all sectors.
+*/
+typedef struct
+{
+    Fls_AddressType u32StartAddr;           /**< @brief first logical address of the run */
+    Fls_AddressType u32EndAddr;             /**< @brief last logical address of the run */
+    Fls_SectorIndexType u32FirstSector;     /**< @brief index of the first logical sector of the run */
+    uint8_t u8SectorShift;                  /**< @brief log2 of the sector size within the run */
+} Fls_SectorRunType;
+
 /**
  * @brief Pointer type of Fls_AC_Callback function
 */
@@ -316,6 +335,84 @@ typedef enum
     MEMIF_MODE_FAST             /**< @brief The underlying memory abstraction modules and drivers are working in fast mode */
 }MemIf_ModeType;
 
+/**
+* @brief          Context of a job parked to serve a read job in between.
+* @details        Holds the job iterators and hardware job state of an erase or
+*                 write job while a read job borrows the job variables.
+*/
+typedef struct
+{
+    boolean bParked;                    /**< @brief a job is parked */
+    boolean bSuspended;                 /**< @brief the hardware operation of the parked job is suspended */
+    Fls_JobType eJob;                   /**< @brief type of the parked job */
+    Fls_SectorIndexType u32SectorIt;    /**< @brief sector iterator of the parked job */
+    Fls_SectorIndexType u32SectorEnd;   /**< @brief last sector of the parked job */
+    Fls_AddressType u32AddrIt;          /**< @brief address iterator of the parked write job */
+    Fls_AddressType u32AddrEnd;         /**< @brief last address of the parked write job */
+    const uint8 * pDataSrcPtr;          /**< @brief source data of the parked write job */
+    Fls_LLDJobType eLLDJob;             /**< @brief asynchronous hardware job of the parked job */
+    Fls_LLDIrqJobType eLLDIrqJob;       /**< @brief interrupt mode hardware job of the parked job */
+    MemIf_JobResultType eLLDJobResult;  /**< @brief hardware job result of the parked job */
+} Fls_ParkedJobType;
+
+/**
+* @brief          State and decision counters of the adaptive transfer budget.
+* @details        The budgets move between FLS_ADAPTIVE_MIN_BUDGET and the
+*                 budgets of the current mode, see Fls_SetMode.
+*/
+typedef struct
+{
+    Fls_LengthType u32ReadBudget;       /**< @brief current read/compare budget per Fls_MainFunction call */
+    Fls_LengthType u32WriteBudget;      /**< @brief current write budget per Fls_MainFunction call */
+    uint32 u32LastSliceTime;            /**< @brief duration of the last measured transfer in FLS_GET_TIMESTAMP ticks */
+    uint32 u32GrowCount;                /**< @brief transfers after which a budget was doubled */
+    uint32 u32ShrinkCount;              /**< @brief transfers after which a budget was halved */
+    uint32 u32HoldCount;                /**< @brief transfers after which a budget was kept */
+} Fls_AdaptiveStatsType;
+
+/**
+* @brief          Operations of a flash channel backend.
+* @details        One table per channel type (internal flash, external flash,
+*                 host simulation), selected through Fls_ConfigType::paChannelOps
+*                 by the channel of the sector. Sectors are physical sector indexes.
+*                 Optional operations are NULL_PTR when the backend lacks them.
+*/
+typedef struct
+{
+    /** @brief initialize the backend, E_NOT_OK when the flash can't be used */
+    Std_ReturnType (*pfInit)( void );
+    /** @brief erase ePhySector, a backend able to erase a whole run of sectors with one
+               command may erase up to ePhySectorLast and move the sector iterator past it */
+    Fls_LLDReturnType (*pfErase)( const Fls_PhysicalSectorType ePhySector, const Fls_PhysicalSectorType ePhySectorLast,
+                                  const boolean bAsynch );
+    /** @brief program data within one sector */
+    Fls_LLDReturnType (*pfWrite)( const Fls_PhysicalSectorType ePhySector, const Fls_AddressType u32SectorOffset,
+                                  const Fls_LengthType u32DataLength, const uint8 * const pDataPtr, const boolean bAsynch );
+    /** @brief read data within one sector */
+    Fls_LLDReturnType (*pfRead)( const Fls_PhysicalSectorType ePhySector, const Fls_AddressType u32SectorOffset,
+                                 Fls_LengthType u32DataLength, uint8 * pDataPtr );
+    /** @brief compare data within one sector with a buffer */
+    Fls_LLDReturnType (*pfCompare)( const Fls_PhysicalSectorType ePhySector, const Fls_AddressType u32SectorOffset,
+                                    Fls_LengthType u32DataLength, const uint8 * pDataPtr );
+    /** @brief check data within one sector is erased */
+    Fls_LLDReturnType (*pfBlankCheck)( const Fls_PhysicalSectorType ePhySector, const Fls_AddressType u32SectorOffset,
+                                       Fls_LengthType u32DataLength );
+    /** @brief poll the asynchronous erase operation */
+    void (*pfMainFunctionErase)( void );
+    /** @brief poll the asynchronous program operation */
+    void (*pfMainFunctionWrite)( void );
+    /** @brief relock the sectors unlocked by the ended erase or write job, optional */
+    void (*pfLockSectors)( void );
+    /** @brief check the running erase can be suspended, optional */
+    boolean (*pfEraseSuspendPossible)( void );
+    /** @brief suspend the running erase, optional */
+    Fls_LLDReturnType (*pfEraseSuspend)( void );
+    /** @brief resume the suspended erase, optional */
+    Fls_LLDReturnType (*pfEraseResume)( void );
+    /** @brief get the bank of a sector, banks can be read while another bank is busy, optional */
+    uint32_t (*pfGetBank)( const Fls_PhysicalSectorType ePhySector );
+} Fls_ChannelOpsType;
+
 #ifdef __cplusplus
 }
 #endif
@@ -38,6 +38,18 @@
 */
 #define STD_IDLE    0x00
 
+/**
+* @brief Logical state on.
+* @implements SymbolDefinitions_enumeration
+*/
+#define STD_ON      0x01
+
+/**
+* @brief Logical state off.
+* @implements SymbolDefinitions_enumeration
+*/
+#define STD_OFF     0x00
+
 
 /**
 * @brief Return code for failure/error.
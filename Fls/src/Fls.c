@@ -1,10 +1,18 @@
 #include "Fls.h"
 #include "Fls_IPW.h"
+
+/* A pending erase or write job can be parked to serve a read job in between */
+#if( (FLS_ERASE_SUSPEND == STD_ON) || (FLS_READ_WHILE_WRITE == STD_ON) )
+    #define FLS_JOB_PARKING          STD_ON
+#else
+    #define FLS_JOB_PARKING          STD_OFF
+#endif
+
 /**
 * @brief Result of last flash module job
 * @implements Fls_eJobResult_Object
 */
-static MemIf_JobResultType Fls_eJobResult = MEMIF_JOB_OK;
+static volatile MemIf_JobResultType Fls_eJobResult = MEMIF_JOB_OK;
 /**
 * @brief Pointer to current position in source data buffer
 * @details Used by both write and compare jobs
@@ -55,6 +63,12 @@ static Fls_LengthType Fls_u32MaxRead = 0UL;
 * @brief Maximum number of bytes to write in one cycle of Fls_MainFunction
 */
 static Fls_LengthType Fls_u32MaxWrite = 0UL;
+#if( FLS_ADAPTIVE_BUDGET == STD_ON )
+/**
+* @brief Adaptive read and write budgets and the controller decision counters
+*/
+static Fls_AdaptiveStatsType Fls_tAdaptiveStats = { 0UL, 0UL, 0UL, 0UL, 0UL, 0UL };
+#endif
 /**
     @brief Result of last flash hardware job
 */
@@ -62,7 +76,7 @@ volatile MemIf_JobResultType Fls_eLLDJobResult = MEMIF_JOB_OK;
 /**
     @brief Type of current flash hardware job - used for asynchronous operating mode.
 */
-Fls_LLDJobType Fls_eLLDJob = FLASH_JOB_NONE;
+volatile Fls_LLDJobType Fls_eLLDJob = FLASH_JOB_NONE;
 /**
     @brief Type of current flash hardware job - used for interrupt operating mode.
 */
@@ -72,21 +86,49 @@ volatile Fls_LLDIrqJobType Fls_eLLDIrqJob = FLASH_IRQ_JOB_NONE;
     @brief Number of bytes of data left to write.
 */
 volatile Fls_LengthType Fls_u32LLDRemainingDataToWrite=0UL;
+/**
+* @brief Hardware operation of a canceled job is still completing
+*/
+static boolean Fls_bCancelDrain = (boolean)FALSE;
+/**
+* @brief Sector of the hardware operation of the canceled job, selects its channel while draining
+*/
+static Fls_SectorIndexType Fls_u32CancelSectorIt = 0UL;
+#if( FLS_JOB_PARKING == STD_ON )
+/**
+* @brief Erase or write job parked while a read job is served
+*/
+static Fls_ParkedJobType Fls_tParkedJob = { (boolean)FALSE, (boolean)FALSE, FLS_JOB_ERASE, 0UL, 0UL,
+                                            0UL, 0UL, NULL_PTR,
+                                            FLASH_JOB_NONE, FLASH_IRQ_JOB_NONE, MEMIF_JOB_OK };
+#endif
 
 /*==================================================================================================
                                    LOCAL FUNCTION PROTOTYPES
 ==================================================================================================*/
 static MemIf_JobResultType Fls_LLDGetJobResult( void );
 static void Fls_LLDClrJobResult( void );
+static boolean Fls_ProcessJob( void );
+static void Fls_DrainCanceledJob( void );
+#if( FLS_JOB_PARKING == STD_ON )
+static Std_ReturnType Fls_ParkJob( const Fls_SectorIndexType u32ReadSectorIt,
+                                   const Fls_SectorIndexType u32ReadSectorEnd );
+static void Fls_ResumeParkedJob( void );
+#endif
 /**
 * @brief        Maps u32TargetAddress to sector index
 *
-* @details      Calculate index of logical sector u32TargetAddress belongs to
+* @details      Calculate index of logical sector u32TargetAddress belongs to.
+*               The geometry descriptor of the configuration splits the sectors
+*               into runs of equal power of two size: the run is binary searched
+*               and the sector within the run is found by a shift, so a uniform
+*               flash (single run) is mapped in constant time.
 *
 * @param[in]    u32TargetAddress Target address in flash memory
 *
 * @return       Zero based index of logical sector
 * @retval       0 .. (Fls_pConfigPtr->u32SectorCount - 1)
+* @retval       Fls_pConfigPtr->u32SectorCount  u32TargetAddress is not configured
 *
 * @pre          The module must be initialized
 * @pre          u32TargetAddress must be in configured flash boundary
@@ -94,20 +136,31 @@ static void Fls_LLDClrJobResult( void );
 */
 static Fls_SectorIndexType Fls_GetSectorIndexByAddr( const Fls_AddressType u32TargetAddress )
 {
-    Fls_SectorIndexType u32SectorIndex = 0UL;
+    Fls_SectorIndexType u32SectorIndex = Fls_pConfigPtr->u32SectorCount;
+    uint32 u32RunLow = 0UL;
+    uint32 u32RunHigh = Fls_pConfigPtr->u32SectorRunCount;
+    uint32 u32RunMid = 0UL;
+    const Fls_SectorRunType * pRun = NULL_PTR;
 
-    for( u32SectorIndex = 0U; u32SectorIndex < Fls_pConfigPtr->u32SectorCount;
-         u32SectorIndex++
-       )
+    while( u32RunLow < u32RunHigh )
     {
-        if( u32TargetAddress <= (*(Fls_pConfigPtr->paSectorEndAddr))[u32SectorIndex] )
+        u32RunMid = u32RunLow + ((u32RunHigh - u32RunLow) >> 1U);
+        pRun = &(*(Fls_pConfigPtr->paSectorRuns))[u32RunMid];
+
+        if( u32TargetAddress < pRun->u32StartAddr )
         {
-            /* u32TargetAddress belongs to sector with index u32SectorIndex */
-            break;
+            u32RunHigh = u32RunMid;
+        }
+        else if( u32TargetAddress > pRun->u32EndAddr )
+        {
+            u32RunLow = u32RunMid + 1UL;
         }
         else
         {
-            /* Check next sector */
+            /* u32TargetAddress belongs to this run */
+            u32SectorIndex = pRun->u32FirstSector +
+                             ((u32TargetAddress - pRun->u32StartAddr) >> pRun->u8SectorShift);
+            break;
         }
     }
     return u32SectorIndex;
@@ -116,7 +169,7 @@ static Fls_SectorIndexType Fls_GetSectorIndexByAddr( const Fls_AddressType u32Ta
 /**
 * @brief        Return start address of given sector
 *
-* @details      Calculate start address (in linear space) of logical sector
+* @details      Look up start address (in linear space) of logical sector
 *               specified by the u32SectorIndex parameter
 *
 * @param[in]    u32SectorIndex Index of logical sector
@@ -130,18 +183,7 @@ static Fls_SectorIndexType Fls_GetSectorIndexByAddr( const Fls_AddressType u32Ta
 */
 static Fls_AddressType Fls_GetSectorStartAddr ( const Fls_SectorIndexType u32SectorIndex )
 {
-    Fls_AddressType u32TargetAddress = 0U;
-
-    if( 0U != u32SectorIndex )
-    {
-        u32TargetAddress = (*(Fls_pConfigPtr->paSectorEndAddr))[u32SectorIndex - 1U] + 1U;
-    }
-    else
-    {
-        /* First sector starts with address 0 */
-    }
-
-    return u32TargetAddress + 1;
+    return (*(Fls_pConfigPtr->paSectorStartAddr))[u32SectorIndex];
 }
 
 /*==================================================================================================
@@ -177,7 +219,6 @@ static Fls_AddressType Fls_GetSectorStartAddr ( const Fls_SectorIndexType u32Sec
 static MemIf_JobResultType  Fls_DoJobErase( void )
 {
     MemIf_JobResultType eRetVal = MEMIF_JOB_PENDING;
-    uint32 u32Datastore = 0UL;
 
     /*
     * @violates @ref fls_c_REF_4 No reliance shall be placed on
@@ -236,10 +277,11 @@ static MemIf_JobResultType  Fls_DoJobErase( void )
                    Fls_IPW_LLDMainFunction()(for Async erase) or in the IRQ routine(for Irq mode).
                    when completing the job.
                 2. If the operation is Sync erase, than the sector is increased below because the job is complete.
+
+               The mode is taken from before the erase was started, the completion interrupt of an
+               Irq erase may already have moved Fls_u32JobSectorIt on.
             */
-            u32Datastore = (*(Fls_pConfigPtr->paSectorFlags))[Fls_u32JobSectorIt];
-            if( ( 0U == ( u32Datastore & FLS_SECTOR_ERASE_ASYNCH) ) && ( 0U == ( u32Datastore & FLS_SECTOR_IRQ_MODE) )
-              )
+            if( (boolean)FALSE == bAsynch )
             {
                 Fls_u32JobSectorIt++;
             }
@@ -250,6 +292,153 @@ static MemIf_JobResultType  Fls_DoJobErase( void )
     return( eRetVal );
 }
 
+#if( FLS_JOB_PARKING == STD_ON )
+/**
+* @brief        Park the pending erase or write job to serve a read job
+*
+* @details      Save the job context so that the job variables can be used by a
+*               read job. With no hardware operation running the job is parked
+*               as it is. A hardware operation running on the other flash bank
+*               than the read keeps running (read-while-write), a sector erase
+*               on the same bank is suspended if the flash array supports it.
+*
+* @param[in]    u32ReadSectorIt     First sector of the read job
+* @param[in]    u32ReadSectorEnd    Last sector of the read job
+*
+* @return       Std_ReturnType
+* @retval       E_OK        Job parked, the read job can be configured
+* @retval       E_NOT_OK    Hardware operation blocks the flash array of the read
+*
+* @pre          An erase or write job is pending and no job is parked
+*/
+static Std_ReturnType Fls_ParkJob( const Fls_SectorIndexType u32ReadSectorIt,
+                                   const Fls_SectorIndexType u32ReadSectorEnd )
+{
+    Std_ReturnType u8RetVal = (Std_ReturnType)E_OK;
+
+#if( FLS_READ_WHILE_WRITE == STD_OFF )
+    UNUSED(u32ReadSectorIt);
+    UNUSED(u32ReadSectorEnd);
+#endif
+
+    Fls_tParkedJob.bSuspended = (boolean)FALSE;
+
+    if( FLASH_JOB_NONE == Fls_eLLDJob )
+    {
+        /* No hardware operation running, nothing to suspend */
+    }
+#if( FLS_READ_WHILE_WRITE == STD_ON )
+    else if( (boolean)TRUE == Fls_IPW_ReadWhileWritePossible( u32ReadSectorIt, u32ReadSectorEnd ) )
+    {
+        /* Hardware operation keeps running on the other bank */
+    }
+#endif
+#if( FLS_ERASE_SUSPEND == STD_ON )
+    else if( (FLS_JOB_ERASE == Fls_eJob) &&
+             ((boolean)TRUE == Fls_IPW_EraseSuspendPossible()) &&
+             (FLASH_E_OK == Fls_IPW_EraseSuspend())
+           )
+    {
+        Fls_tParkedJob.bSuspended = (boolean)TRUE;
+    }
+#endif
+    else
+    {
+        /* The read has to wait for the hardware operation to finish */
+        u8RetVal = (Std_ReturnType)E_NOT_OK;
+    }
+
+    if( (Std_ReturnType)E_OK == u8RetVal )
+    {
+        Fls_tParkedJob.bParked = (boolean)TRUE;
+        Fls_tParkedJob.eJob = Fls_eJob;
+        Fls_tParkedJob.u32SectorIt = Fls_u32JobSectorIt;
+        Fls_tParkedJob.u32SectorEnd = Fls_u32JobSectorEnd;
+        Fls_tParkedJob.u32AddrIt = Fls_u32JobAddrIt;
+        Fls_tParkedJob.u32AddrEnd = Fls_u32JobAddrEnd;
+        Fls_tParkedJob.pDataSrcPtr = Fls_pJobDataSrcPtr;
+        Fls_tParkedJob.eLLDJob = Fls_eLLDJob;
+        Fls_tParkedJob.eLLDIrqJob = Fls_eLLDIrqJob;
+        Fls_tParkedJob.eLLDJobResult = Fls_eLLDJobResult;
+
+        /* The parked hardware operation isn't polled, let Fls_MainFunction process the read */
+        Fls_eLLDJob = FLASH_JOB_NONE;
+        Fls_eLLDIrqJob = FLASH_IRQ_JOB_NONE;
+    }
+    else
+    {
+        /* Job continues */
+    }
+
+    return( u8RetVal );
+}
+
+/**
+* @brief        Continue the job parked by Fls_ParkJob
+*
+* @details      Restore the job context once the read job has ended and resume
+*               the suspended sector erase. A hardware operation which kept
+*               running on the other bank is polled by Fls_MainFunction from
+*               now on, as its completion interrupt may already have been
+*               taken. If the sector erase can't be resumed the job fails in
+*               the next Fls_MainFunction cycle.
+*
+* @post         Fls_eJobResult is MEMIF_JOB_PENDING again if a job was parked
+*/
+static void Fls_ResumeParkedJob( void )
+{
+    if( (boolean)TRUE == Fls_tParkedJob.bParked )
+    {
+        Fls_tParkedJob.bParked = (boolean)FALSE;
+
+        /* Give the job variables back to the parked job */
+        Fls_eJob = Fls_tParkedJob.eJob;
+        Fls_u32JobSectorIt = Fls_tParkedJob.u32SectorIt;
+        Fls_u32JobSectorEnd = Fls_tParkedJob.u32SectorEnd;
+        Fls_u32JobAddrIt = Fls_tParkedJob.u32AddrIt;
+        Fls_u32JobAddrEnd = Fls_tParkedJob.u32AddrEnd;
+        Fls_pJobDataSrcPtr = Fls_tParkedJob.pDataSrcPtr;
+        Fls_u8JobStart = 0U;
+        Fls_eLLDJob = Fls_tParkedJob.eLLDJob;
+        Fls_eLLDIrqJob = FLASH_IRQ_JOB_NONE;
+        Fls_eLLDJobResult = Fls_tParkedJob.eLLDJobResult;
+
+        if( (boolean)TRUE == Fls_tParkedJob.bSuspended )
+        {
+            /* Mark the interrupt mode job before the erase can complete */
+            Fls_eLLDIrqJob = Fls_tParkedJob.eLLDIrqJob;
+
+            if( FLASH_E_OK != Fls_IPW_EraseResume() )
+            {
+                /* Report the erase job failed in the next cycle */
+                Fls_eLLDJob = FLASH_JOB_NONE;
+                Fls_eLLDIrqJob = FLASH_IRQ_JOB_NONE;
+                Fls_eLLDJobResult = MEMIF_JOB_FAILED;
+            }
+            else
+            {
+                /* Sector erase continues */
+            }
+        }
+        else if( FLASH_JOB_NONE == Fls_eLLDJob )
+        {
+            /* Job continues with the next sector or page */
+            Fls_eLLDJobResult = MEMIF_JOB_OK;
+        }
+        else
+        {
+            /* Hardware operation ran on the other bank, poll its completion */
+        }
+
+        Fls_eJobResult = MEMIF_JOB_PENDING;
+    }
+    else
+    {
+        /* No parked job */
+    }
+}
+#endif
+
 /**
 * @brief       Calculate last logical address to read, write, or compare
 *              from in current cycle of Fls_MainFunction
@@ -283,8 +472,6 @@ static Fls_AddressType Fls_CalcMaxTransferAddrEnd ( const Fls_LengthType u32MaxT
         /* No adjustment is necessary. Job will finish in this cycle
             of Fls_MainFunction */
     }
-    MemIf_JobResultType eRetVal = MEMIF_JOB_PENDING;
-    uint32 u32Datastore = 0UL;
     return( u32MaxTransferEndAddr );
 }
 
@@ -347,7 +534,6 @@ static Fls_AddressType Fls_CalcSectorTransferLength ( const Fls_AddressType u32M
     if( u32SectorEndAddr > u32MaxTransferEndAddr )
     {
         u32SectorEndAddr = u32MaxTransferEndAddr;
-		Fls_LLDReturnType eRetVal = FLASH_E_OK;
     }
     else
     {
@@ -384,7 +570,7 @@ static Fls_LLDReturnType Fls_DoJobRead (const Fls_AddressType u32SectorOffset, c
 {
     Fls_LLDReturnType eRetVal = FLASH_E_OK;
 
-    eRetVal = Fls_IPW_SectorRead( grtb5tnn, u32Length, Fls_pJobDataDestPtr );
+    eRetVal = Fls_IPW_SectorRead( u32SectorOffset, u32Length, Fls_pJobDataDestPtr );
 
     /* Do physical sector read */
     if( FLASH_E_FAILED == eRetVal )
@@ -394,6 +580,55 @@ static Fls_LLDReturnType Fls_DoJobRead (const Fls_AddressType u32SectorOffset, c
     return( eRetVal );
 }
 
+/**
+* @brief       Compare up to one physical flash sector with data buffer
+*
+* @details      Call low level flash driver service to compare given number of bytes
+*               at given sector offset with the data buffer, directly on the mapped flash.
+*
+* @param[in]    u32SectorOffset Flash sector offset to compare data from
+* @param[in]    u32Length Number of bytes to compare
+*
+* @return       Fls_LLDReturnType
+* @retval       FLASH_E_OK compare operation succeeded, data are equal
+* @retval       FLASH_E_BLOCK_INCONSISTENT data buffer doesn't match with content of flash memory
+* @retval       FLASH_E_FAILED compare operation failed due to a hardware error
+*
+* @pre          The module must be initialized, the Fls_u32JobSectorIt internal job
+*               variable must contain valid index of logical sector to compare,
+*               u32SectorOffset and u32Length must be in physical sector boundary,
+*               Fls_pJobDataSrcPtr internal job variable must point to data buffer
+*
+*/
+static Fls_LLDReturnType Fls_DoJobCompare (const Fls_AddressType u32SectorOffset, const Fls_AddressType u32Length)
+{
+    return( Fls_IPW_SectorCompare( u32SectorOffset, u32Length, Fls_pJobDataSrcPtr ) );
+}
+
+/**
+* @brief       Blank check up to one physical flash sector
+*
+* @details      Call low level flash driver service to check that given number of
+*               bytes at given sector offset are erased.
+*
+* @param[in]    u32SectorOffset Flash sector offset to check from
+* @param[in]    u32Length Number of bytes to check
+*
+* @return       Fls_LLDReturnType
+* @retval       FLASH_E_OK flash area is erased
+* @retval       FLASH_E_BLOCK_INCONSISTENT flash area isn't erased
+* @retval       FLASH_E_FAILED blank check failed due to a hardware error
+*
+* @pre          The module must be initialized, the Fls_u32JobSectorIt internal job
+*               variable must contain valid index of logical sector to check,
+*               u32SectorOffset and u32Length must be in physical sector boundary
+*
+*/
+static Fls_LLDReturnType Fls_DoJobBlankCheck (const Fls_AddressType u32SectorOffset, const Fls_AddressType u32Length)
+{
+    return( Fls_IPW_SectorBlankCheck( u32SectorOffset, u32Length ) );
+}
+
 /**
 * @brief        Write up to one physical flash sector
 *
@@ -410,19 +645,19 @@ static Fls_LLDReturnType Fls_DoJobRead (const Fls_AddressType u32SectorOffset, c
 * @pre          The module must be initialized, the Fls_u32JobSectorIt internal job
 *               variable must contain valid index of logical sector to write,
 *               u32SectorOffset and u32Length must be in physical sector boundary and page
-*               aligned, Fls_pJobDataSrcPtr internal job variable must point to data
-                write buffer
+*               aligned, pJobDataSrcPtr must point to data write buffer
 *
 * @implements     Fls_DoJobWrite_Activity
 *
 */
-static Fls_LLDReturnType Fls_DoJobWrite ( const Fls_AddressType u32SectorOffset, const Fls_AddressType u32Length)
+static Fls_LLDReturnType Fls_DoJobWrite ( const Fls_AddressType u32SectorOffset, const Fls_AddressType u32Length,
+                                          const uint8 * pJobDataSrcPtr )
 {
     Fls_LLDReturnType eRetVal = FLASH_E_OK;
     boolean bAsynch = (boolean)0;
 
     /* Get the Fls_IPW_SectorWrite function operation mode */
-    if( (*(Fls_pConfigPtr->paSectorFlags))[FlsfervrtgbectorIt] &
+    if( (*(Fls_pConfigPtr->paSectorFlags))[Fls_u32JobSectorIt] &
         (FLS_PAGE_WRITE_ASYNCH | FLS_SECTOR_IRQ_MODE)
       )
     {
@@ -435,7 +670,7 @@ static Fls_LLDReturnType Fls_DoJobWrite ( const Fls_AddressType u32SectorOffset,
         bAsynch = (boolean)FALSE;
     }
 
-    eRetVal = Fls_IPW_SectorWrite( u32SectorOffset, u32Length, Fls_pJobDataSrcPtr, bAsynch );
+    eRetVal = Fls_IPW_SectorWrite( u32SectorOffset, u32Length, pJobDataSrcPtr, bAsynch );
 
     if( FLASH_E_FAILED == eRetVal )
     {
@@ -489,7 +724,7 @@ static MemIf_JobResultType Fls_DoJobDataTransfer (const Fls_JobType eJob, const
 
         /* Last address to transfer data to/from in this call of
             the Fls_MainFunction() functions */
-        u32MaxTransferAddrEnd = Fls_CalcMwrvb34htAddrEnd( u32MaxTransfer );
+        u32MaxTransferAddrEnd = Fls_CalcMaxTransferAddrEnd( u32MaxTransfer );
 
         /* Transfer sector by sector until the u32MaxTransferAddrEnd address is reached
             or error is detected */
@@ -497,6 +732,7 @@ static MemIf_JobResultType Fls_DoJobDataTransfer (const Fls_JobType eJob, const
         {
             Fls_AddressType u32SectorTransferOffset = 0UL;
             Fls_AddressType u32SectorTransferLength = 0UL;
+            const uint8 * pWriteSrcPtr = NULL_PTR;
 
             /* Calculate offset and length of the sector data transfer */
             u32SectorTransferOffset = Fls_CalcSectorTransferOffset();
@@ -511,15 +747,18 @@ static MemIf_JobResultType Fls_DoJobDataTransfer (const Fls_JobType eJob, const
             switch( eJob )
             {
                 case FLS_JOB_WRITE:
-                    eTransferRetVal =  Fls_DoJobWrite( u32SectorTransferOffset,
-                                                      u32SectorTransferLength
-                                                    );
-                    /* Update the source data pointer for next write */
+                    pWriteSrcPtr = Fls_pJobDataSrcPtr;
+                    /* Update the source data pointer for next write before the write is started,
+                       the completion interrupt of an IRQ mode sector continues from it */
                     /*
                     * @violates @ref fls_c_REF_7 Array indexing shall be the
                     * only allowed form of pointer arithmetic
                     */
                     Fls_pJobDataSrcPtr += u32SectorTransferLength;
+                    eTransferRetVal =  Fls_DoJobWrite( u32SectorTransferOffset,
+                                                      u32SectorTransferLength,
+                                                      pWriteSrcPtr
+                                                    );
                     break;
 
                 case FLS_JOB_READ:
@@ -535,6 +774,25 @@ static MemIf_JobResultType Fls_DoJobDataTransfer (const Fls_JobType eJob, const
                     Fls_pJobDataDestPtr += u32SectorTransferLength;
                     break;
 
+                case FLS_JOB_COMPARE:
+                    eTransferRetVal =  Fls_DoJobCompare( u32SectorTransferOffset,
+                                                        u32SectorTransferLength
+                                                      );
+
+                    /* Update the source data pointer for next compare */
+                    /*
+                    * @violates @ref fls_c_REF_7 Array indexing shall be the
+                    * only allowed form of pointer arithmetic
+                    */
+                    Fls_pJobDataSrcPtr += u32SectorTransferLength;
+                    break;
+
+                case FLS_JOB_BLANK_CHECK:
+                    eTransferRetVal =  Fls_DoJobBlankCheck( u32SectorTransferOffset,
+                                                           u32SectorTransferLength
+                                                         );
+                    break;
+
                 default:
                     /* Do nothing - should not happen in Fully Trusted Environment;
                        "default" clause added to fulfill MISRA Rule 15.3 */
@@ -599,6 +857,110 @@ static MemIf_JobResultType Fls_DoJobDataTransfer (const Fls_JobType eJob, const
     return( eRetVal );
 }
 
+#if( FLS_ADAPTIVE_BUDGET == STD_ON )
+/**
+* @brief        Restart the adaptive budgets from the budgets of the current mode
+*
+* @pre          Fls_u32MaxRead and Fls_u32MaxWrite must hold the budgets of the
+*               current mode
+*/
+static void Fls_AdaptiveReset( void )
+{
+    Fls_tAdaptiveStats.u32ReadBudget = Fls_u32MaxRead;
+    Fls_tAdaptiveStats.u32WriteBudget = Fls_u32MaxWrite;
+}
+
+/**
+* @brief        Adapt a budget to the time its slice took, see Fls_DoJobAdaptiveTransfer
+*
+* @param[in]    eResult          Result of the slice
+* @param[in]    u32Elapsed       Time the slice took in FLS_GET_TIMESTAMP ticks
+* @param[in,out] pu32Budget      Adaptive budget of the job type
+* @param[in]    u32MaxBudget     Budget of the current mode, upper limit
+*/
+static void Fls_DoJobAdaptBudget( const MemIf_JobResultType eResult,
+                                  const uint32 u32Elapsed,
+                                  Fls_LengthType * pu32Budget,
+                                  const Fls_LengthType u32MaxBudget )
+{
+    Fls_LengthType u32Budget = 0UL;
+
+    Fls_tAdaptiveStats.u32LastSliceTime = u32Elapsed;
+
+    if( (u32Elapsed > FLS_ADAPTIVE_TIME_SLICE) && (*pu32Budget > FLS_ADAPTIVE_MIN_BUDGET) )
+    {
+        /* Overran the slice, halve down to a whole number of minimum budgets */
+        u32Budget = (*pu32Budget / 2UL) - ((*pu32Budget / 2UL) % FLS_ADAPTIVE_MIN_BUDGET);
+        *pu32Budget = (u32Budget > FLS_ADAPTIVE_MIN_BUDGET) ? u32Budget : FLS_ADAPTIVE_MIN_BUDGET;
+        Fls_tAdaptiveStats.u32ShrinkCount++;
+    }
+    else if( (u32Elapsed <= (FLS_ADAPTIVE_TIME_SLICE / 2UL)) &&
+             (MEMIF_JOB_PENDING == eResult) &&
+             (*pu32Budget < u32MaxBudget)
+           )
+    {
+        /* Full budget transferred well within the slice, double to a whole number of
+           minimum budgets */
+        u32Budget = (*pu32Budget * 2UL) - ((*pu32Budget * 2UL) % FLS_ADAPTIVE_MIN_BUDGET);
+        *pu32Budget = (u32Budget < u32MaxBudget) ? u32Budget : u32MaxBudget;
+        Fls_tAdaptiveStats.u32GrowCount++;
+    }
+    else
+    {
+        Fls_tAdaptiveStats.u32HoldCount++;
+    }
+}
+
+/**
+* @brief        Transfer one budgeted slice of a read, write, compare or blank
+*               check job and adapt the budget to the time the slice took
+*
+* @details      A slice longer than FLS_ADAPTIVE_TIME_SLICE halves the budget,
+*               down to FLS_ADAPTIVE_MIN_BUDGET. A slice that took at most half of
+*               it doubles the budget, up to u32MaxBudget, unless the job ended in
+*               this slice and hence transferred less than the budget. Halved and
+*               doubled budgets are rounded down to a multiple of
+*               FLS_ADAPTIVE_MIN_BUDGET, so every slice but the last of a job
+*               stays page aligned.
+*               FLS_GET_TIMESTAMP() must be mapped to a running timer, with the
+*               default constant every slice looks instant and the budget stays
+*               at u32MaxBudget. Host builds map it to Fls_Sim_GetTime() of the
+*               host flash model.
+*               A slice on a FLS_SECTOR_IRQ_MODE sector keeps the budget, its
+*               completion interrupt may already run the next slice.
+*
+* @param[in]    eJob             Type of job to run
+* @param[in,out] pu32Budget      Adaptive budget of the job type
+* @param[in]    u32MaxBudget     Budget of the current mode, upper limit
+*
+* @return       MemIf_JobResultType  Result of Fls_DoJobDataTransfer
+*/
+static MemIf_JobResultType Fls_DoJobAdaptiveTransfer( const Fls_JobType eJob,
+                                                      Fls_LengthType * pu32Budget,
+                                                      const Fls_LengthType u32MaxBudget )
+{
+    MemIf_JobResultType eRetVal = MEMIF_JOB_PENDING;
+    uint32 u32Start = 0UL;
+    uint32 u32Elapsed = 0UL;
+
+    if( 0U != ((*(Fls_pConfigPtr->paSectorFlags))[Fls_u32JobSectorIt] & FLS_SECTOR_IRQ_MODE) )
+    {
+        /* Nothing shared may be written once the operation is started */
+        eRetVal = Fls_DoJobDataTransfer( eJob, *pu32Budget );
+    }
+    else
+    {
+        u32Start = FLS_GET_TIMESTAMP();
+        eRetVal = Fls_DoJobDataTransfer( eJob, *pu32Budget );
+        u32Elapsed = FLS_GET_TIMESTAMP() - u32Start;
+
+        Fls_DoJobAdaptBudget( eRetVal, u32Elapsed, pu32Budget, u32MaxBudget );
+    }
+
+    return( eRetVal );
+}
+#endif
+
 
 /*==================================================================================================
                                        GLOBAL FUNCTIONS
@@ -641,14 +1003,18 @@ void Fls_Init(void)
 		}
 		else
 		{
-			Fls_u32MaxRead = Fls_pConfigPtr->whfdiwhfirwi3hfo;
+			Fls_u32MaxRead = Fls_pConfigPtr->u32MaxReadFastMode;
 			Fls_u32MaxWrite = Fls_pConfigPtr->u32MaxWriteFastMode;
 		}
-		/* Initialize flash hardware
-		   NOTE: The variable 'Fls_eLLDJobResult' will be updated in the below function*/
-		Fls_IPW_Init();
-
-		if(  MEMIF_JOB_FAILED == Fls_eLLDJobResult )
+#if( FLS_ADAPTIVE_BUDGET == STD_ON )
+		Fls_tAdaptiveStats.u32LastSliceTime = 0UL;
+		Fls_tAdaptiveStats.u32GrowCount = 0UL;
+		Fls_tAdaptiveStats.u32ShrinkCount = 0UL;
+		Fls_tAdaptiveStats.u32HoldCount = 0UL;
+		Fls_AdaptiveReset();
+#endif
+		/* Initialize flash hardware */
+		if( ((Std_ReturnType)E_OK) != Fls_IPW_Init() )
 		{
 			Fls_eJobResult = MEMIF_JOB_FAILED;
 		}
@@ -688,7 +1054,8 @@ void Fls_Init(void)
 Std_ReturnType Fls_Erase(Fls_AddressType u32TargetAddress,Fls_LengthType u32Length)
 {
     Std_ReturnType u8RetVal = (Std_ReturnType)E_OK;
-
+    Fls_SectorIndexType u32TmpJobSectorIt = 0UL;
+    Fls_SectorIndexType u32TmpJobSectorEnd = 0UL;
 
     /* Perform calculations outside the critical section in order
         to limit time spend in the CS */
@@ -783,6 +1150,80 @@ MemIf_JobResultType Fls_GetJobResult( void )
     return( eRetVal );
 }
 
+/**
+* @brief            Sets the flash driver's operation mode.
+* @details          Selects how many bytes a job reads or writes per
+*                   Fls_MainFunction call: the normal mode budgets for
+*                   MEMIF_MODE_SLOW, the fast mode budgets for MEMIF_MODE_FAST.
+*                   The request is ignored while a job is pending, so a job always
+*                   finishes with the budgets it was started with.
+*
+* @param[in]        eMode        MEMIF_MODE_SLOW or MEMIF_MODE_FAST.
+*
+* @api
+*
+* @pre              The module has to be initialized and not busy.
+*
+*/
+/*
+* @violates @ref fls_c_REF_8 All declarations and definitions
+* of objects or functions at file scope shall have internal linkage unless external linkage required
+*/
+void Fls_SetMode( MemIf_ModeType eMode )
+{
+    if( (NULL_PTR == Fls_pConfigPtr) || (MEMIF_JOB_PENDING == Fls_eJobResult) )
+    {
+        /* Module not initialized or busy, keep the current mode */
+    }
+    else if( MEMIF_MODE_FAST == eMode )
+    {
+        Fls_u32MaxRead = Fls_pConfigPtr->u32MaxReadFastMode;
+        Fls_u32MaxWrite = Fls_pConfigPtr->u32MaxWriteFastMode;
+    }
+    else
+    {
+        Fls_u32MaxRead = Fls_pConfigPtr->u32MaxReadNormalMode;
+        Fls_u32MaxWrite = Fls_pConfigPtr->u32MaxWriteNormalMode;
+    }
+
+#if( FLS_ADAPTIVE_BUDGET == STD_ON )
+    if( (NULL_PTR != Fls_pConfigPtr) && (MEMIF_JOB_PENDING != Fls_eJobResult) )
+    {
+        /* The new mode sets new upper limits */
+        Fls_AdaptiveReset();
+    }
+#endif
+}
+
+#if( FLS_ADAPTIVE_BUDGET == STD_ON )
+/**
+* @brief            Returns the state of the adaptive transfer budget.
+* @details          Copies the current read and write budgets, the duration of the
+*                   last measured transfer and the counters of the grow, shrink and
+*                   hold decisions taken since Fls_Init.
+*
+* @param[out]       pStats       Destination of the statistics.
+*
+* @api
+*
+*/
+/*
+* @violates @ref fls_c_REF_8 All declarations and definitions
+* of objects or functions at file scope shall have internal linkage unless external linkage required
+*/
+void Fls_GetAdaptiveStats( Fls_AdaptiveStatsType * pStats )
+{
+    if( NULL_PTR != pStats )
+    {
+        *pStats = Fls_tAdaptiveStats;
+    }
+    else
+    {
+        /* Nothing to copy to */
+    }
+}
+#endif
+
 /*
 * @implements       Fls_Read_Activity
 *
@@ -795,22 +1236,43 @@ Std_ReturnType Fls_Read (Fls_AddressType u32SourceAddress, uint8 * pTargetAddres
 {
     Std_ReturnType u8RetVal = (Std_ReturnType)E_OK;
     Fls_SectorIndexType u32TmpJobSectorIt = 0UL;
+    Fls_SectorIndexType u32TmpJobSectorEnd = 0UL;
     Fls_AddressType u32TmpJobAddrEnd = 0UL;
 
     /* Perform calculations outside the critical section in order
         to limit time spend in the CS */
-    u32TmpJobSectorIt = Fls_GetSeefhi3rhfiByAddr( u32SourceAddress );
+    u32TmpJobSectorIt = Fls_GetSectorIndexByAddr( u32SourceAddress );
     u32TmpJobAddrEnd = ( u32SourceAddress + u32Length ) - 1U;
+    u32TmpJobSectorEnd = Fls_GetSectorIndexByAddr( u32TmpJobAddrEnd );
 
     if( MEMIF_JOB_PENDING == Fls_eJobResult )
     {
+#if( FLS_JOB_PARKING == STD_ON )
+        if( ((FLS_JOB_ERASE == Fls_eJob) || (FLS_JOB_WRITE == Fls_eJob)) &&
+            ((boolean)FALSE == Fls_tParkedJob.bParked)
+          )
+        {
+            /* Serve the read in between, the pending job continues after it */
+            u8RetVal = Fls_ParkJob( u32TmpJobSectorIt, u32TmpJobSectorEnd );
+        }
+        else
+        {
+            u8RetVal = (Std_ReturnType)E_NOT_OK;
+        }
+#else
         u8RetVal = (Std_ReturnType)E_NOT_OK;
+#endif
     }
     else
+    {
+        /* No job pending */
+    }
+
+    if( (Std_ReturnType)E_OK == u8RetVal )
     {
         /* Configure the read job */
         Fls_u32JobSectorIt = u32TmpJobSectorIt;
-        Fls_u32JobSectorEnd = Fls_GetSectorIndexByAddr(u32TmpJobAddrEnd);
+        Fls_u32JobSectorEnd = u32TmpJobSectorEnd;
         Fls_u32JobAddrIt = u32SourceAddress;
         Fls_u32JobAddrEnd = u32TmpJobAddrEnd;
         Fls_pJobDataDestPtr = pTargetAddressPtr;
@@ -826,28 +1288,243 @@ Std_ReturnType Fls_Read (Fls_AddressType u32SourceAddress, uint8 * pTargetAddres
 }
 
 /**
-* @brief            Performs actual flash read, write, erase and compare jobs.
-* @details          Bytes number processed per cycle depends by job type (erase, write, read, compare)
-*                   current FLS module's operating mode (normal, fast)
-*                   and write, erase Mode of Execution (sync, async).
+* @brief            Compare the contents of an area of flash memory with a data buffer.
+* @details          Starts a compare job asynchronously. The actual job is performed by
+*                   @p Fls_MainFunction, on the mapped flash without copying it to RAM,
+*                   up to the configured maximum read length per cycle.
+*
+* @param[in]        u32SourceAddress     Source address in flash memory.
+* @param[in]        pTargetAddressPtr    Pointer to data buffer to compare with.
+* @param[in]        u32Length            Number of bytes to compare.
+*
+* @return           Std_ReturnType
+* @retval           E_OK                 Compare command has been accepted.
+* @retval           E_NOT_OK             Compare command has not been accepted.
 *
 * @api
 *
-* @pre              The module has to be initialized.
+* @pre              The module has to be initialized and not busy.
+* @post             @p Fls_Compare changes module status and some internal variables
+*                   (@p Fls_u32JobSectorIt, @p Fls_u32JobAddrIt, @p Fls_u32JobAddrEnd,
+*                   @p Fls_pJobDataSrcPtr, @p Fls_eJob, @p Fls_eJobResult).
+*
+* @note             The job result is MEMIF_BLOCK_INCONSISTENT if the data differ.
+*/
+/*
+* @violates @ref fls_c_REF_8 All declarations and definitions
+* of objects or functions at file scope shall have internal linkage unless external linkage required
+*/
+Std_ReturnType Fls_Compare (Fls_AddressType u32SourceAddress, const uint8 * pTargetAddressPtr, Fls_LengthType u32Length)
+{
+    Std_ReturnType u8RetVal = (Std_ReturnType)E_OK;
+    Fls_SectorIndexType u32TmpJobSectorIt = 0UL;
+    Fls_AddressType u32TmpJobAddrEnd = 0UL;
+
+    /* Perform calculations outside the critical section in order
+        to limit time spend in the CS */
+    u32TmpJobSectorIt = Fls_GetSectorIndexByAddr( u32SourceAddress );
+    u32TmpJobAddrEnd = ( u32SourceAddress + u32Length ) - 1U;
+
+    if( MEMIF_JOB_PENDING == Fls_eJobResult )
+    {
+        u8RetVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else
+    {
+        /* Configure the compare job */
+        Fls_u32JobSectorIt = u32TmpJobSectorIt;
+        Fls_u32JobSectorEnd = Fls_GetSectorIndexByAddr( u32TmpJobAddrEnd );
+        Fls_u32JobAddrIt = u32SourceAddress;
+        Fls_u32JobAddrEnd = u32TmpJobAddrEnd;
+        Fls_pJobDataSrcPtr = pTargetAddressPtr;
+        Fls_eJob = FLS_JOB_COMPARE;
+        Fls_u8JobStart = 1U;
+
+        /* Execute the compare job */
+        Fls_eJobResult = MEMIF_JOB_PENDING;
+    }
+    return( u8RetVal );
+}
+
+/**
+* @brief            Verify whether a given memory area has been erased.
+* @details          Starts a blank check job asynchronously. The actual job is performed
+*                   by @p Fls_MainFunction, on the mapped flash without copying it to RAM,
+*                   up to the configured maximum read length per cycle.
 *
+* @param[in]        u32TargetAddress     Address in flash memory to start the check from.
+* @param[in]        u32Length            Number of bytes to check.
 *
-* @implements       Fls_MainFunction_Activity
+* @return           Std_ReturnType
+* @retval           E_OK                 Blank check command has been accepted.
+* @retval           E_NOT_OK             Blank check command has not been accepted.
 *
-* @note             This function have to be called ciclically by the Basic Software Module;
-*                   it will do nothing if there aren't pending job.
+* @api
+*
+* @pre              The module has to be initialized and not busy.
+* @post             @p Fls_BlankCheck changes module status and some internal variables
+*                   (@p Fls_u32JobSectorIt, @p Fls_u32JobAddrIt, @p Fls_u32JobAddrEnd,
+*                   @p Fls_eJob, @p Fls_eJobResult).
+*
+* @note             The job result is MEMIF_BLOCK_INCONSISTENT if the area isn't erased.
 */
 /*
 * @violates @ref fls_c_REF_8 All declarations and definitions
 * of objects or functions at file scope shall have internal linkage unless external linkage required
 */
-void Fls_MainFunction( void )
+Std_ReturnType Fls_BlankCheck (Fls_AddressType u32TargetAddress, Fls_LengthType u32Length)
+{
+    Std_ReturnType u8RetVal = (Std_ReturnType)E_OK;
+    Fls_SectorIndexType u32TmpJobSectorIt = 0UL;
+    Fls_AddressType u32TmpJobAddrEnd = 0UL;
+
+    /* Perform calculations outside the critical section in order
+        to limit time spend in the CS */
+    u32TmpJobSectorIt = Fls_GetSectorIndexByAddr( u32TargetAddress );
+    u32TmpJobAddrEnd = ( u32TargetAddress + u32Length ) - 1U;
+
+    if( MEMIF_JOB_PENDING == Fls_eJobResult )
+    {
+        u8RetVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else
+    {
+        /* Configure the blank check job */
+        Fls_u32JobSectorIt = u32TmpJobSectorIt;
+        Fls_u32JobSectorEnd = Fls_GetSectorIndexByAddr( u32TmpJobAddrEnd );
+        Fls_u32JobAddrIt = u32TargetAddress;
+        Fls_u32JobAddrEnd = u32TmpJobAddrEnd;
+        Fls_eJob = FLS_JOB_BLANK_CHECK;
+        Fls_u8JobStart = 1U;
+
+        /* Execute the blank check job */
+        Fls_eJobResult = MEMIF_JOB_PENDING;
+    }
+    return( u8RetVal );
+}
+
+/**
+* @brief            Cancel the ongoing flash job.
+* @details          The job ends immediately with MEMIF_JOB_CANCELED and the job
+*                   error notification is called. A parked job is canceled as well.
+*                   Internal flash operations can't be aborted: a page program or
+*                   sector erase already started completes in the background, but
+*                   no further page or sector is started. A job requested in the
+*                   meantime starts as soon as that operation has completed, i.e.
+*                   within one page program time for a write job.
+*
+* @api
+*
+* @pre              The module has to be initialized.
+*
+* @post             Fls_eJobResult is MEMIF_JOB_CANCELED if a job was pending
+*/
+/*
+* @violates @ref fls_c_REF_8 All declarations and definitions
+* of objects or functions at file scope shall have internal linkage unless external linkage required
+*/
+void Fls_Cancel( void )
 {
     if( MEMIF_JOB_PENDING == Fls_eJobResult )
+    {
+#if( FLS_JOB_PARKING == STD_ON )
+        /* Give the job variables back to the parked job so its hardware
+           operation can complete */
+        Fls_ResumeParkedJob();
+#endif
+        /* Don't chain further program units to the running one */
+        Fls_u32LLDRemainingDataToWrite = 0UL;
+
+        if( FLASH_JOB_NONE != Fls_eLLDJob )
+        {
+            /* Let the running hardware operation complete on the channel of its sector */
+            Fls_u32CancelSectorIt = Fls_u32JobSectorIt;
+            Fls_bCancelDrain = (boolean)TRUE;
+        }
+        else
+        {
+            /* Relock the sectors unlocked by the job */
+            Fls_IPW_LockSectors();
+        }
+
+        Fls_eJobResult = MEMIF_JOB_CANCELED;
+
+        if( NULL_PTR != Fls_pConfigPtr->jobErrorNotificationPtr )
+        {
+            /* Call FlsJobErrorNotification function if configured */
+            Fls_pConfigPtr->jobErrorNotificationPtr();
+        }
+        else
+        {
+            /* Callback notification configured as null pointer */
+        }
+    }
+    else
+    {
+        /* No job to cancel */
+    }
+}
+
+/**
+* @brief            Complete the hardware operation of a canceled job
+* @details          Polls the erase or program operation still running after
+*                   Fls_Cancel without starting another one. The sector iterator
+*                   may already belong to a newly requested job, possibly on
+*                   another channel. The operation is polled on the sector
+*                   stored by Fls_Cancel and the iterator is restored afterwards.
+*
+* @post             Fls_bCancelDrain is FALSE once the operation has completed
+*/
+static void Fls_DrainCanceledJob( void )
+{
+    Fls_SectorIndexType u32SectorIt = Fls_u32JobSectorIt;
+
+    if( FLASH_JOB_NONE != Fls_eLLDJob )
+    {
+        Fls_u32JobSectorIt = Fls_u32CancelSectorIt;
+        Fls_IPW_LLDMainFunction();
+        Fls_u32JobSectorIt = u32SectorIt;
+    }
+    else
+    {
+        /* Operation completed already */
+    }
+
+    if( FLASH_JOB_NONE == Fls_eLLDJob )
+    {
+        Fls_bCancelDrain = (boolean)FALSE;
+
+        /* Relock the sectors unlocked by the canceled job */
+        Fls_IPW_LockSectors();
+    }
+    else
+    {
+        /* Still running, poll again in the next cycle */
+    }
+}
+
+/**
+* @brief            Process one cycle of the pending flash job
+* @details          Advances the pending job by one cycle worth of data and calls
+*                   the job end or job error notification once it has finished.
+*
+* @return           boolean
+* @retval           TRUE    Job has finished and the notification was called
+* @retval           FALSE   No job pending, or job continues in a later cycle
+*
+* @pre              The module has to be initialized.
+*/
+static boolean Fls_ProcessJob( void )
+{
+    boolean bJobEnded = (boolean)FALSE;
+
+    if( (boolean)TRUE == Fls_bCancelDrain )
+    {
+        /* A new job has to wait until the canceled one left the hardware */
+        Fls_DrainCanceledJob();
+    }
+
+    if( (MEMIF_JOB_PENDING == Fls_eJobResult) && ((boolean)FALSE == Fls_bCancelDrain) )
     {
         MemIf_JobResultType eWorkResult = MEMIF_JOB_OK;
 
@@ -885,12 +1562,22 @@ void Fls_MainFunction( void )
                         eWorkResult = Fls_DoJobErase();
                     break;
                 case FLS_JOB_WRITE:
+#if( FLS_ADAPTIVE_BUDGET == STD_ON )
+                        eWorkResult = Fls_DoJobAdaptiveTransfer( Fls_eJob, &Fls_tAdaptiveStats.u32WriteBudget, Fls_u32MaxWrite );
+#else
                         eWorkResult = Fls_DoJobDataTransfer( Fls_eJob, Fls_u32MaxWrite );
+#endif
                     break;
                 case FLS_JOB_READ:
-                /* For Read and Compare jobs the static function Fls_DoJobDataTransfer( )
+                case FLS_JOB_COMPARE:
+                case FLS_JOB_BLANK_CHECK:
+                /* For Read, Compare and Blank Check jobs the static function Fls_DoJobDataTransfer( )
                    will be used with the same input parameters */
+#if( FLS_ADAPTIVE_BUDGET == STD_ON )
+                        eWorkResult = Fls_DoJobAdaptiveTransfer( Fls_eJob, &Fls_tAdaptiveStats.u32ReadBudget, Fls_u32MaxRead );
+#else
                         eWorkResult = Fls_DoJobDataTransfer( Fls_eJob, Fls_u32MaxRead );
+#endif
                     break;
                 default:
                     /* Do nothing - should not happen in Fully Trusted Environment;
@@ -903,10 +1590,35 @@ void Fls_MainFunction( void )
             /* eWorkResult != MEMIF_JOB_OK */
         }
 
-        Fls_eJobResult = eWorkResult;
+        if( MEMIF_JOB_PENDING != eWorkResult )
+        {
+            Fls_eJobResult = eWorkResult;
+        }
+        else
+        {
+            /* Fls_eJobResult is pending since the job was accepted. The completion interrupt
+               of the operation just started on an IRQ mode sector may already have ended the job,
+               its result must not be overwritten */
+        }
 
         if( MEMIF_JOB_OK == eWorkResult )
         {
+            bJobEnded = (boolean)TRUE;
+
+#if( FLS_JOB_PARKING == STD_ON )
+            /* A read served in between has ended, continue the parked job */
+            Fls_ResumeParkedJob();
+#endif
+            if( MEMIF_JOB_PENDING != Fls_eJobResult )
+            {
+                /* Relock the sectors unlocked by the job */
+                Fls_IPW_LockSectors();
+            }
+            else
+            {
+                /* Parked job continues, sectors stay unlocked */
+            }
+
             if( NULL_PTR != Fls_pConfigPtr->jobEndNotificationPtr )
             {
                 /* Call FlsJobEndNotification function if configured */
@@ -921,6 +1633,21 @@ void Fls_MainFunction( void )
                 ( MEMIF_BLOCK_INCONSISTENT == eWorkResult )
                 )
         {
+            bJobEnded = (boolean)TRUE;
+
+#if( FLS_JOB_PARKING == STD_ON )
+            /* A read served in between has ended, continue the parked job */
+            Fls_ResumeParkedJob();
+#endif
+            if( MEMIF_JOB_PENDING != Fls_eJobResult )
+            {
+                /* Relock the sectors unlocked by the job */
+                Fls_IPW_LockSectors();
+            }
+            else
+            {
+                /* Parked job continues, sectors stay unlocked */
+            }
 
             if( NULL_PTR != Fls_pConfigPtr->jobErrorNotificationPtr )
             {
@@ -943,6 +1670,95 @@ void Fls_MainFunction( void )
     {
         /* Nothing to do since no job is pending */
     }
+
+    return( bJobEnded );
+}
+
+/**
+* @brief            Performs actual flash read, write, erase and compare jobs.
+* @details          Bytes number processed per cycle depends by job type (erase, write, read, compare)
+*                   current FLS module's operating mode (normal, fast)
+*                   and write, erase Mode of Execution (sync, async).
+*                   With FLS_JOB_CONTINUATION enabled, a job requested by the job
+*                   end or job error notification is started in the same call, up
+*                   to FLS_MAX_CHAINED_JOBS jobs, as long as the previous job
+*                   completed without an asynchronous hardware operation pending.
+*
+* @api
+*
+* @pre              The module has to be initialized.
+*
+*
+* @implements       Fls_MainFunction_Activity
+*
+* @note             This function have to be called ciclically by the Basic Software Module;
+*                   it will do nothing if there aren't pending job.
+*/
+/*
+* @violates @ref fls_c_REF_8 All declarations and definitions
+* of objects or functions at file scope shall have internal linkage unless external linkage required
+*/
+void Fls_MainFunction( void )
+{
+#if( FLS_JOB_CONTINUATION == STD_ON )
+    uint8 u8ChainedJobs = 0U;
+    boolean bJobEnded = (boolean)FALSE;
+#endif
+
+    if( FLASH_IRQ_JOB_NONE != Fls_eLLDIrqJob )
+    {
+        /* Hardware job on an IRQ mode sector completes in Fls_IrqHandler, nothing to poll */
+    }
+    else
+    {
+#if( FLS_JOB_CONTINUATION == STD_ON )
+        do
+        {
+            bJobEnded = Fls_ProcessJob();
+            u8ChainedJobs++;
+        }
+        /* Continue only with a job the notification has just requested */
+        while( ((boolean)TRUE == bJobEnded) &&
+               (MEMIF_JOB_PENDING == Fls_eJobResult) &&
+               (u8ChainedJobs < FLS_MAX_CHAINED_JOBS)
+             );
+#else
+        (void)Fls_ProcessJob();
+#endif
+    }
+}
+
+/**
+* @brief            Flash operation completion interrupt handler.
+* @details          Completes the erase or write hardware operation of a sector
+*                   configured with FLS_SECTOR_IRQ_MODE, starts the next page or
+*                   sector of the job and calls the job end or job error
+*                   notification directly once the job has finished.
+*
+* @api
+*
+* @pre              The module has to be initialized.
+*
+* @note             To be called by the flash command complete interrupt, or by the
+*                   simulated completion event of a host flash model. The job end
+*                   and job error notifications, and the Fee statistics and trace
+*                   hooks behind them, then run in interrupt context. The task side
+*                   doesn't touch the job state once it has started an operation on
+*                   an IRQ mode sector, the start command is its last write.
+*/
+void Fls_IrqHandler( void )
+{
+    /* Clear the completion flag before the next operation can be started */
+    FLS_FLASH_IRQ_ACK();
+
+    if( FLASH_IRQ_JOB_NONE != Fls_eLLDIrqJob )
+    {
+        (void)Fls_ProcessJob();
+    }
+    else
+    {
+        /* No IRQ mode hardware job, spurious interrupt */
+    }
 }
 
 /**
@@ -957,7 +1773,7 @@ static MemIf_JobResultType Fls_LLDGetJobResult( void )
 * @brief          Clear status of erase or write hardware job result.
 * @details        Set the internal status to  MEMIF_JOB_OK
 */
-static void Fls_FCClrJobResult( void )
+static void Fls_LLDClrJobResult( void )
 {
     Fls_eLLDJobResult = MEMIF_JOB_OK;
     Fls_eLLDJob = FLASH_JOB_NONE;
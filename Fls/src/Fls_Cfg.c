@@ -6,6 +6,8 @@
 * 3) internal and external interfaces from this unit
 ==================================================================================================*/
 #include "Fls_Cfg.h"
+#include "Fls_Flash.h"
+#include "Fls_Sim.h"
 
 extern void Fee_JobEndNotification( void );
 
@@ -26,7 +28,6 @@ static const uint8 FlsConfigSet_aFlsSectorUnlock[4] =
     4U, /* (FlsSector_1) */
     1U, /* (FlsSector_2) */
     1U /* (FlsSector_3) */
-    FLS_SECTOR_ERASE_ASYNCH /* (FlsSector_3) */
 };
 
 /* aFlsSectorEndAddr[] (FlsConfigSet) */
@@ -137,15 +138,43 @@ static const Fls_Flash_InternalSectorInfoType * const FlsConfigSet_aSectorList[4
 };
 
 
+/* aFlsSectorRuns[] (FlsConfigSet): geometry descriptor, runs of equal sized sectors */
+static const Fls_SectorRunType FlsConfigSet_aFlsSectorRuns[1] =
+{
+    /* FlsSector_0 .. FlsSector_3, 1024 bytes each */
+    { (Fls_AddressType)0U, (Fls_AddressType)4095U, 0U, 10U }
+};
+
 /* External QSPI flash parameters. */
 
+#if( FLS_SIM_BACKEND == STD_ON )
+/* Internal flash sectors are served by the host flash model */
+#define FLS_CFG_CH_INTERN   FLS_CH_SIM
+#else
+#define FLS_CFG_CH_INTERN   FLS_CH_INTERN
+#endif
+
 /* paHwCh[] (FlsConfigSet) */
 static const Fls_HwChType FlsConfigSet_paHwCh[4] =
 {
-    FLS_CH_INTERN, /* (FlsSector_0) */
-    FLS_CH_INTERN, /* (FlsSector_1) */
-    FLS_CH_INTERN, /* (FlsSector_2) */
-    FLS_CH_INTERN /* (FlsSector_3) */
+    FLS_CFG_CH_INTERN, /* (FlsSector_0) */
+    FLS_CFG_CH_INTERN, /* (FlsSector_1) */
+    FLS_CFG_CH_INTERN, /* (FlsSector_2) */
+    FLS_CFG_CH_INTERN /* (FlsSector_3) */
+};
+
+/* paChannelOps[] (FlsConfigSet) */
+static const Fls_ChannelOpsType * const FlsConfigSet_aChannelOps[FLS_HW_CH_COUNT] =
+{
+#if( FLS_SIM_BACKEND == STD_ON )
+    NULL_PTR, /* FLS_CH_INTERN, not built on the host */
+    NULL_PTR, /* FLS_CH_QSPI, no sector configured */
+    &Fls_Sim_tChannelOps /* FLS_CH_SIM */
+#else
+    &Fls_Flash_tChannelOps, /* FLS_CH_INTERN */
+    NULL_PTR, /* FLS_CH_QSPI, no sector configured */
+    NULL_PTR /* FLS_CH_SIM, host builds only */
+#endif
 };
 
 
@@ -180,7 +209,10 @@ const Fls_ConfigType Fls_Config=
     &FlsConfigSet_aFlsSectorPageSize,               /* (*paSectorPageSize)[] */    
     &FlsConfigSet_aFlsSectorUnlock,                 /* (*paSectorUnlock)[] */
     &FlsConfigSet_paHwCh,                           /* (*paHwCh)[] */
+    &FlsConfigSet_aChannelOps,                      /* (*paChannelOps)[] */
     NULL_PTR, /* pFlsQspiCfgConfig */
+    1U, /* FlsSectorRunCount */
+    &FlsConfigSet_aFlsSectorRuns,                   /* (*paSectorRuns)[] */
     50513U /* configCrc */
 };
 
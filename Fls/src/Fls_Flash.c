@@ -29,9 +29,15 @@
 #define STATUS_RE_ERROR      0x00BUL
 
 
+#define FLS_FLASH_ERASED_BYTE    0xFFU
+#define FLS_FLASH_ERASED_WORD    0xFFFFFFFFUL
+
 #define FLASH_BLOCK_SELECT0    0x000UL
 #define FLASH_BLOCK_SELECT1    0x001UL
 
+#define FLASH_BANK_SIZE        0x00040000UL
+#define FLASH_BANK1_BASE       FLASH_BANK_SIZE
+
 #define FLASH_PRGM_SIZE1     2UL
 #define FLASH_PRGM_SIZE2     4UL
 #define FLASH_PRGM_SIZE3     6UL
@@ -92,6 +98,12 @@
 #define FLASH_BUF_PREF_DISABLE    0x0UL
 #define FLASH_BUF_PREF_ENABLE     0x1UL
 
+#if (FLS_CALL_COUNTERS == STD_ON)
+#define FLASHDRIVER_COUNT(counter)    (s_tFlashCallCounters.counter++)
+#else
+#define FLASHDRIVER_COUNT(counter)    ((void)0)
+#endif
+
 #define FLASH_READ_WAIT_LOCK_DISABLE    0x0UL
 #define FLASH_READ_WAIT_LOCK_ENABLE     0x1UL
 
@@ -216,6 +228,25 @@ typedef struct
     FLASH_AUTO_HOLD_FUNC                    FLASH_DRV_ENABLE_HOLD_CFG;
 } FLASH_ROM_API_ENTRY_T;
 
+/** ROM entry points used by the program/erase paths, resolved once */
+typedef struct
+{
+    uint32_t u32EraseBlock;
+    uint32_t u32EraseBlockClear;
+    uint32_t u32EraseSector;
+    uint32_t u32EraseSectorClear;
+    uint32_t u32Program;
+    uint32_t u32ProgramClear;
+    uint32_t u32HVStatusCheck;
+} FLASH_ROM_API_CACHE_T;
+
+/** completion deadline of the running erase or program operation */
+typedef struct
+{
+    uint32_t u32Start;      /* FLS_GET_TIMESTAMP() when the operation was started */
+    uint32_t u32Timeout;    /* ticks the operation may take */
+} FLASH_HV_DEADLINE_T;
+
 
 
 /* ################################################################################## */
@@ -225,6 +256,21 @@ typedef struct
 
 static  const FLASH_ROM_API_ENTRY_T  *s_pFlashDriver_FuncHeader = (const FLASH_ROM_API_ENTRY_T *)(FLASHDRV_ADDR);
 
+/** resolved ROM entry points, zero until FLASHDRIVER_ResolveRomApi has run */
+static FLASH_ROM_API_CACHE_T s_tFlashRomApi = {0UL, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL};
+
+/** deadline shared by the synchronous FLASHDRIVER_* and asynchronous Fls_Flash_* paths */
+static FLASH_HV_DEADLINE_T s_tFlashHvDeadline = {0UL, 0UL};
+
+/** last value written to FB_FPELCK of each bank, a cleared bit is an unlocked sector */
+static uint32_t s_au32FlashLockMask[2U] = {0xFFFFFFFFU, 0xFFFFFFFFU};
+
+#if (FLS_CALL_COUNTERS == STD_ON)
+/** lock register writes and ROM calls since Fls_Flash_Init */
+static Fls_Flash_CallCountersType s_tFlashCallCounters;
+static const Fls_Flash_CallCountersType s_tFlashCallCountersReset = {0UL, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL};
+#endif
+
 
 
 /* ################################################################################## */
@@ -239,10 +285,17 @@ static FLASH_StatusType FLASHDRIVER_WriteCheck(FLASH_DRIVER_ParamType *pFlashPar
 static FLASH_StatusType FLASHDRIVER_LockSector(uint32_t u32Address, uint8_t bLock);
 static FLASH_StatusType FLASHDRIVER_GetFlashConfig(uint32_t u32Address, FLASH_DRV_ERASESECTOR_CFG_T *pFlash_api_cfg);
 static uint32_t FLASHDRIVER_LL_EraseSector(FLASH_DRV_ERASESECTOR_CFG_T *flash_api_cfg);
+static uint32_t FLASHDRIVER_LL_EraseBlock(uint32_t u32BlkSel);
+static uint32_t FLASHDRIVER_LL_EraseBlockClear(void);
 static uint32_t FLASHDRIVER_LL_HVStatusCheck(void);
+static void FLASHDRIVER_HVDeadlineStart(uint32_t u32TimeoutUs);
+static uint32_t FLASHDRIVER_HVPoll(void);
+static FLASH_StatusType FLASHDRIVER_HVWait(const FLASH_DRIVER_ParamType *pFlashParam, uint32_t u32MaxPolls);
 static uint32_t FLASHDRIVER_LL_EraseSectorClear(void);
 static uint32_t FLASHDRIVER_LL_Program(FLASH_DRV_PRGM_CFG_T *flash_api_cfg);
 static uint32_t FLASHDRIVER_LL_ProgramClear(void);
+static void FLASHDRIVER_ResolveRomApi(void);
+static void FLASHDRIVER_LockAll(void);
 
 
 /* ################################################################################## */
@@ -338,45 +391,87 @@ static FLASH_StatusType FLASHDRIVER_WriteCheck(FLASH_DRIVER_ParamType *pFlashPar
 /**
  * \brief Flash Driver Function for lock/unlock sector
  *
+ * Unlocked sectors accumulate until the bank is locked again, the lock register
+ * is only written when its value changes.
+ *
  * \param u32Address sector address
- * \param bLock 0U-unlock, 1U-lock
+ * \param bLock 0U-unlock, 1U-lock all sectors of the bank
  */
 static FLASH_StatusType FLASHDRIVER_LockSector(uint32_t u32Address, uint8_t bLock)
 {
     FLASH_StatusType tRetVal;
+    uint32_t u32Bank = 0U;
+    uint32_t u32Mask = 0U;
     tRetVal = FLASH_ERROR_OK;
 
     if (u32Address <= FLASH_BANK0_END)
     {
-        if (bLock)
-        {
-            FMC->FB_FPELCK[0U] = 0xFFFFFFFFU;
-        }
-        else
-        {
-            FMC->FB_FPELCK[0U] = 0xFFFFFFFFU ^ (1UL << (u32Address >> 13));
-        }
-
+        u32Bank = 0U;
+        u32Mask = 1UL << (u32Address >> 13);
     }
     else if (u32Address < FLASH_BANK1_END)
     {
-        if (bLock)
-        {
-            FMC->FB_FPELCK[1U]  = 0xFFFFFFFFU;
-        }
-        else
-        {
-            FMC->FB_FPELCK[1U]  = 0xFFFFFFFFU ^ (1UL << ((u32Address - 0x40000) >> 13));
-        }
+        u32Bank = 1U;
+        u32Mask = 1UL << ((u32Address - FLASH_BANK1_BASE) >> 13);
     }
     else
     {
         tRetVal = FLASH_ERROR_INVALID_ADDR;
     }
 
+    if (tRetVal == FLASH_ERROR_OK)
+    {
+        FLASHDRIVER_COUNT(u32LockRequests);
+        u32Mask = bLock ? 0xFFFFFFFFU : (s_au32FlashLockMask[u32Bank] & ~u32Mask);
+
+        if (u32Mask != s_au32FlashLockMask[u32Bank])
+        {
+            s_au32FlashLockMask[u32Bank] = u32Mask;
+            FMC->FB_FPELCK[u32Bank] = u32Mask;
+            FLASHDRIVER_COUNT(u32LockWrites);
+        }
+    }
+
     return tRetVal;
 }
 
+/**
+ * \brief Relock all sectors unlocked since the last lock
+ */
+static void FLASHDRIVER_LockAll(void)
+{
+    FLASHDRIVER_COUNT(u32LockRequests);
+
+    if (s_au32FlashLockMask[0U] != 0xFFFFFFFFU)
+    {
+        s_au32FlashLockMask[0U] = 0xFFFFFFFFU;
+        FMC->FB_FPELCK[0U] = 0xFFFFFFFFU;
+        FLASHDRIVER_COUNT(u32LockWrites);
+    }
+
+    if (s_au32FlashLockMask[1U] != 0xFFFFFFFFU)
+    {
+        s_au32FlashLockMask[1U] = 0xFFFFFFFFU;
+        FMC->FB_FPELCK[1U] = 0xFFFFFFFFU;
+        FLASHDRIVER_COUNT(u32LockWrites);
+    }
+}
+
+/**
+ * \brief Resolve the ROM entry points used by the program/erase paths
+ */
+static void FLASHDRIVER_ResolveRomApi(void)
+{
+    FLASHDRIVER_COUNT(u32RomResolves);
+    s_tFlashRomApi.u32EraseBlock       = (uint32_t)(s_pFlashDriver_FuncHeader->FLASH_DRV_EraseBlock);
+    s_tFlashRomApi.u32EraseBlockClear  = (uint32_t)(s_pFlashDriver_FuncHeader->FLASH_DRV_EraseBlock_Clear);
+    s_tFlashRomApi.u32EraseSector      = (uint32_t)(s_pFlashDriver_FuncHeader->FLASH_DRV_EraseSector);
+    s_tFlashRomApi.u32EraseSectorClear = (uint32_t)(s_pFlashDriver_FuncHeader->FLASH_DRV_EraseSector_Clear);
+    s_tFlashRomApi.u32Program          = (uint32_t)(s_pFlashDriver_FuncHeader->FLASH_DRV_Program);
+    s_tFlashRomApi.u32ProgramClear     = (uint32_t)(s_pFlashDriver_FuncHeader->FLASH_DRV_Program_Clear);
+    s_tFlashRomApi.u32HVStatusCheck    = (uint32_t)(s_pFlashDriver_FuncHeader->FLASH_DRV_HV_Status_Check);
+}
+
 /**
  * \brief Get Flash Configuration
  *
@@ -418,7 +513,8 @@ static uint32_t FLASHDRIVER_LL_EraseSector(FLASH_DRV_ERASESECTOR_CFG_T *flash_ap
     uint32_t u32FuncAddr;
     uint32_t u32RetVal;
 
-    u32FuncAddr = (uint32_t)(s_pFlashDriver_FuncHeader->FLASH_DRV_EraseSector);
+    u32FuncAddr = s_tFlashRomApi.u32EraseSector;
+    FLASHDRIVER_COUNT(u32RomErase);
 
     asm volatile(
                 "MOV     R1, %1\n\t"
@@ -433,6 +529,58 @@ static uint32_t FLASHDRIVER_LL_EraseSector(FLASH_DRV_ERASESECTOR_CFG_T *flash_ap
     return u32RetVal;
 }
 
+/**
+ * \brief Erase Block Asm Entry
+ *
+ * \param u32BlkSel FLASH_BLOCK_SELECT0 or FLASH_BLOCK_SELECT1
+ * \return STATUS_SUCCESS is OK, others are not ok
+ */
+static uint32_t FLASHDRIVER_LL_EraseBlock(uint32_t u32BlkSel)
+{
+    uint32_t u32FuncAddr;
+    uint32_t u32RetVal;
+
+    u32FuncAddr = s_tFlashRomApi.u32EraseBlock;
+    FLASHDRIVER_COUNT(u32RomErase);
+
+    asm volatile(
+                "MOV     R1, %1\n\t"
+                "MOV     R0, %2\n\t"
+                "BLX     R1\n\t"
+                "MOV     %0, R0\n\t"
+                : "=r"(u32RetVal)
+                : "r"(u32FuncAddr), "r"(u32BlkSel)
+                : "memory", "r0", "r1", "r2", "r3", "r4", "r14"
+    );
+
+    return u32RetVal;
+}
+
+/**
+ * \brief Call After FLASHDRIVER_LL_EraseBlock to clear status
+ *
+ * \return STATUS_SUCCESS is OK, others are not ok
+ */
+static uint32_t FLASHDRIVER_LL_EraseBlockClear(void)
+{
+    uint32_t u32FuncAddr;
+    uint32_t u32RetVal;
+
+    u32FuncAddr = s_tFlashRomApi.u32EraseBlockClear;
+    FLASHDRIVER_COUNT(u32RomClear);
+
+    asm volatile(
+                "MOV     R0, %1\n\t"
+                "BLX     R0\n\t"
+                "MOV     %0, R0\n\t"
+                : "=r"(u32RetVal)
+                : "r"(u32FuncAddr)
+                : "memory", "r0", "r1", "r2", "r3", "r14"
+    );
+
+    return u32RetVal;
+}
+
 /**
  * \brief Check HV status
  *
@@ -443,7 +591,8 @@ static uint32_t FLASHDRIVER_LL_HVStatusCheck(void)
     uint32_t u32FuncAddr;
     uint32_t u32RetVal;
 
-    u32FuncAddr = (uint32_t)(s_pFlashDriver_FuncHeader->FLASH_DRV_HV_Status_Check);
+    u32FuncAddr = s_tFlashRomApi.u32HVStatusCheck;
+    FLASHDRIVER_COUNT(u32RomStatus);
 
     asm volatile(
                 "MOV     R0, %1\n\t"
@@ -457,6 +606,83 @@ static uint32_t FLASHDRIVER_LL_HVStatusCheck(void)
     return u32RetVal;
 }
 
+/**
+ * \brief Arm the deadline of the erase or program operation just started
+ *
+ * \param u32TimeoutUs time the operation may take in microseconds
+ */
+static void FLASHDRIVER_HVDeadlineStart(uint32_t u32TimeoutUs)
+{
+    s_tFlashHvDeadline.u32Start = FLS_GET_TIMESTAMP();
+    s_tFlashHvDeadline.u32Timeout = u32TimeoutUs * FLS_TIMESTAMP_TICKS_PER_US;
+}
+
+/**
+ * \brief Check the running operation once against its deadline
+ *
+ * \return STATUS_HVOP while in progress within the deadline, STATUS_SUCCESS when
+ *         finished, STATUS_ERROR when the deadline has passed
+ */
+static uint32_t FLASHDRIVER_HVPoll(void)
+{
+    uint32_t u32RetVal;
+
+    u32RetVal = FLASHDRIVER_LL_HVStatusCheck();
+
+    if (u32RetVal != STATUS_HVOP)
+    {
+        u32RetVal = STATUS_SUCCESS;
+    }
+    else if ((FLS_GET_TIMESTAMP() - s_tFlashHvDeadline.u32Start) > s_tFlashHvDeadline.u32Timeout)
+    {
+        /* wrap-safe elapsed time is over the allowed duration */
+        u32RetVal = STATUS_ERROR;
+    }
+    else
+    {
+        /* still in progress */
+    }
+
+    return u32RetVal;
+}
+
+/**
+ * \brief Wait for the operation of a synchronous erase or write
+ *
+ * The CPU is handed to wdTriggerFct between the polls. u32MaxPolls bounds the
+ * wait when FLS_GET_TIMESTAMP() is not mapped to a running timer.
+ *
+ * \param pFlashParam flash driver parameter
+ * \param u32MaxPolls FLS_ERASE_MAX_POLLS or FLS_WRITE_MAX_POLLS
+ * \return FLASH_ERROR_OK when finished, FLASH_ERROR_FAILED when timed out
+ */
+static FLASH_StatusType FLASHDRIVER_HVWait(const FLASH_DRIVER_ParamType *pFlashParam, uint32_t u32MaxPolls)
+{
+    uint32_t u32Temp;
+    uint32_t u32Polls = 1UL;
+
+    u32Temp = FLASHDRIVER_HVPoll();
+    while (u32Temp == STATUS_HVOP)
+    {
+        if (u32Polls >= u32MaxPolls)
+        {
+            /* the deadline never expired, the operation is stuck */
+            u32Temp = STATUS_ERROR;
+        }
+        else
+        {
+            if (pFlashParam->wdTriggerFct != ((void *)0))
+            {
+                pFlashParam->wdTriggerFct();
+            }
+            u32Temp = FLASHDRIVER_HVPoll();
+            u32Polls++;
+        }
+    }
+
+    return (u32Temp == STATUS_SUCCESS) ? FLASH_ERROR_OK : FLASH_ERROR_FAILED;
+}
+
 /**
  * \brief Call After FLASHDRIVER_LL_EraseSector to clear status
  *
@@ -467,7 +693,8 @@ static uint32_t FLASHDRIVER_LL_EraseSectorClear(void)
     uint32_t u32FuncAddr;
     uint32_t u32RetVal;
 
-    u32FuncAddr = (uint32_t)(s_pFlashDriver_FuncHeader->FLASH_DRV_EraseSector_Clear);
+    u32FuncAddr = s_tFlashRomApi.u32EraseSectorClear;
+    FLASHDRIVER_COUNT(u32RomClear);
 
     asm volatile(
                 "MOV     R0, %1\n\t"
@@ -492,7 +719,8 @@ static uint32_t FLASHDRIVER_LL_Program(FLASH_DRV_PRGM_CFG_T *flash_api_cfg)
     uint32_t u32FuncAddr;
     uint32_t u32RetVal;
 
-    u32FuncAddr = (uint32_t)(s_pFlashDriver_FuncHeader->FLASH_DRV_Program);
+    u32FuncAddr = s_tFlashRomApi.u32Program;
+    FLASHDRIVER_COUNT(u32RomProgram);
 
     asm volatile(
                 "MOV     R1, %1\n\t"
@@ -517,7 +745,8 @@ static uint32_t FLASHDRIVER_LL_ProgramClear(void)
     uint32_t u32FuncAddr;
     uint32_t u32RetVal;
 
-    u32FuncAddr = (uint32_t)(s_pFlashDriver_FuncHeader->FLASH_DRV_Program_Clear);
+    u32FuncAddr = s_tFlashRomApi.u32ProgramClear;
+    FLASHDRIVER_COUNT(u32RomClear);
 
     asm volatile(
                 "MOV     R0, %1\n\t"
@@ -540,7 +769,6 @@ static uint32_t FLASHDRIVER_LL_ProgramClear(void)
 FLASH_StatusType FLASHDRIVER_Erase(FLASH_DRIVER_ParamType *pFlashParam)
 {
     uint32_t u32Addr, u32Length;
-    uint32_t u32TryCount;
     FLASH_DRV_ERASESECTOR_CFG_T tFlash_api_cfg;
     FLASH_StatusType tRetVal;
     uint32_t u32Temp;
@@ -559,6 +787,11 @@ FLASH_StatusType FLASHDRIVER_Erase(FLASH_DRIVER_ParamType *pFlashParam)
 
     tRetVal = FLASHDRIVER_LL_EraseCheck(pFlashParam);
 
+    if (s_tFlashRomApi.u32EraseSector == 0UL)
+    {
+        FLASHDRIVER_ResolveRomApi();
+    }
+
     if (tRetVal == FLASH_ERROR_OK)
     {
 
@@ -593,23 +826,10 @@ FLASH_StatusType FLASHDRIVER_Erase(FLASH_DRIVER_ParamType *pFlashParam)
             }
             else
             {
+                FLASHDRIVER_HVDeadlineStart(FLS_ERASE_TIMEOUT_US);
                 FLASHDRIVER_LL_Delay();
-                /* check erasing still in progress */
-                tRetVal = FLASH_ERROR_FAILED;
-                u32TryCount = 0;
-                while ((tRetVal != FLASH_ERROR_OK) && (u32TryCount++ < 100000))
-                {
-                    u32Temp = FLASHDRIVER_LL_HVStatusCheck();
-                    /* check if finished */
-                    if (u32Temp == STATUS_HVOP)
-                    {
-                        tRetVal = FLASH_ERROR_FAILED;
-                    }
-                    else
-                    {
-                        tRetVal = FLASH_ERROR_OK;
-                    }
-                }
+                /* wait until erasing is finished or the deadline has passed */
+                tRetVal = FLASHDRIVER_HVWait(pFlashParam, FLS_ERASE_MAX_POLLS);
 
                 if (tRetVal != FLASH_ERROR_OK)
                 {
@@ -642,6 +862,9 @@ FLASH_StatusType FLASHDRIVER_Erase(FLASH_DRIVER_ParamType *pFlashParam)
                 }
             }
         }
+
+        /* relock the erased sectors */
+        FLASHDRIVER_LockAll();
     }
 
 
@@ -660,7 +883,6 @@ FLASH_StatusType FLASHDRIVER_Write(FLASH_DRIVER_ParamType *pFlashParam)
     uint32_t u32Addr, u32Length, u32DataAddr, u32AlignLen, u32TempLen;
     /* uint8_t *pTempBuf; */
     uint32_t u32AlignOffset, u32Index, u32Count;
-    uint32_t u32TryCount;
     /* FLASH_DRV_WDG_CFG_T tFlash_wdg_cfg; */
     FLASH_DRV_PRGM_CFG_T tFlash_api_cfg;
 
@@ -680,6 +902,11 @@ FLASH_StatusType FLASHDRIVER_Write(FLASH_DRIVER_ParamType *pFlashParam)
 
     tRetVal = FLASHDRIVER_WriteCheck(pFlashParam);
 
+    if (s_tFlashRomApi.u32Program == 0UL)
+    {
+        FLASHDRIVER_ResolveRomApi();
+    }
+
     if (tRetVal == FLASH_ERROR_OK)
     {
         /* flash watchdog config */
@@ -742,25 +969,11 @@ FLASH_StatusType FLASHDRIVER_Write(FLASH_DRIVER_ParamType *pFlashParam)
             }
             else
             {
+                FLASHDRIVER_HVDeadlineStart(FLS_WRITE_TIMEOUT_US);
                 FLASHDRIVER_LL_Delay();
 
-                /* check write still in progress */
-                tRetVal = FLASH_ERROR_FAILED;
-                u32TryCount = 0;
-                while ((tRetVal != FLASH_ERROR_OK) && (u32TryCount++ < 10000))
-                {
-                    u32Temp = FLASHDRIVER_LL_HVStatusCheck();
-                    /* check if finished */
-                    if (u32Temp == STATUS_HVOP)
-                    {
-                        tRetVal = FLASH_ERROR_FAILED;
-                    }
-                    else
-                    {
-                        tRetVal = FLASH_ERROR_OK;
-                    }
-                }
-
+                /* wait until writing is finished or the deadline has passed */
+                tRetVal = FLASHDRIVER_HVWait(pFlashParam, FLS_WRITE_MAX_POLLS);
 
                 if (tRetVal != FLASH_ERROR_OK)
                 {
@@ -796,6 +1009,9 @@ FLASH_StatusType FLASHDRIVER_Write(FLASH_DRIVER_ParamType *pFlashParam)
 
 
         }
+
+        /* relock the programmed sectors */
+        FLASHDRIVER_LockAll();
     }
 
     return tRetVal;
@@ -863,46 +1079,152 @@ static volatile uint32_t * Fls_Flash_pTargetAddressPtr = NULL_PTR;
 static const uint32_t * Fls_Flash_pSourceAddressPtr = NULL_PTR;
 static const volatile uint8 * volatile Fls_Flash_pReadAddressPtr = NULL_PTR;
 
-static uint32 Fls_Flash_u32DoubleWordToCopy = 0UL;
-static uint32 Fls_Flash_u32ProgramCycle = 0UL;
+/* suspend capabilities of the flash array, the FC4xxx ROM driver provides no
+   erase or program suspend command */
+static const Fls_Flash_ArrayInfoType Fls_Flash_tArrayInfo = {(boolean)FALSE, (boolean)FALSE};
 
-static void  Fls_Flash_PageWrite( const uint32_t Page_size )
+/* the pending erase is a whole bank erase ending at Fls_Flash_u32BlockEraseLast */
+static boolean Fls_Flash_bBlockErase = (boolean)FALSE;
+static Fls_SectorIndexType Fls_Flash_u32BlockEraseLast = 0UL;
+
+static uint32_t Fls_Flash_PageWrite( const uint32_t Page_size )
 {
 	FLASH_DRV_PRGM_CFG_T tFlash_api_cfg;
+	uint32_t u32Temp;
 	FLASHDRIVER_LockSector((uint32_t)Fls_Flash_pTargetAddressPtr, 0U);
 	tFlash_api_cfg.dest = (uint32_t)Fls_Flash_pTargetAddressPtr;
 	tFlash_api_cfg.size = Page_size / 4; /* one data is 4 bytes  */
 	tFlash_api_cfg.pData = (uint32_t *)Fls_Flash_pSourceAddressPtr;
 	tFlash_api_cfg.wdg_tune = WDG_TUNE_DISABLE;
-	FLASHDRIVER_LL_Program(&tFlash_api_cfg);
+	/* the completion interrupt chains the next unit, advance and arm the deadline
+	   before the program command is issued */
 	Fls_Flash_pTargetAddressPtr = Fls_Flash_pTargetAddressPtr + Page_size/4;
 	Fls_Flash_pSourceAddressPtr = Fls_Flash_pSourceAddressPtr + Page_size/4;
+	FLASHDRIVER_HVDeadlineStart(FLS_WRITE_TIMEOUT_US);
+	u32Temp = FLASHDRIVER_LL_Program(&tFlash_api_cfg);
+	return u32Temp;
+}
+
+/**
+ * \brief Mark the hardware job before its operation is started
+ *
+ * The erase or write command must be the last write to the job state: on an
+ * FLS_SECTOR_IRQ_MODE sector the command complete interrupt can run
+ * Fls_IrqHandler before the start function returns. The interrupt is enabled
+ * for IRQ mode sectors only, the other sectors are polled.
+ *
+ * \param ePhySector physical sector of the operation
+ * \param eJob asynchronous hardware job
+ * \param eIrqJob hardware job completed by the interrupt on an IRQ mode sector
+ */
+static void Fls_Flash_JobStart(const Fls_PhysicalSectorType ePhySector, const Fls_LLDJobType eJob,
+                               const Fls_LLDIrqJobType eIrqJob)
+{
+    Fls_eLLDJob = eJob;
+    Fls_eLLDJobResult = MEMIF_JOB_PENDING;
+
+    if (0U != ((*(Fls_pConfigPtr->paSectorFlags))[ePhySector] & FLS_SECTOR_IRQ_MODE))
+    {
+        Fls_eLLDIrqJob = eIrqJob;
+        FLS_FLASH_IRQ_ENABLE();
+    }
+    else
+    {
+        Fls_eLLDIrqJob = FLASH_IRQ_JOB_NONE;
+        FLS_FLASH_IRQ_DISABLE();
+    }
+}
+
+/**
+ * \brief Drop the hardware job marked by Fls_Flash_JobStart, its operation
+ *        could not be started
+ */
+static void Fls_Flash_JobStartFailed( void )
+{
+    FLS_FLASH_IRQ_DISABLE();
+    Fls_eLLDIrqJob = FLASH_IRQ_JOB_NONE;
+    Fls_eLLDJob = FLASH_JOB_NONE;
+    Fls_eLLDJobResult = MEMIF_JOB_FAILED;
+}
+
+/**
+ * \brief Start programming of the next burst unit of the write job
+ *
+ * One ROM program call covers up to FLASH_PROGRAM_PAGE_MAX_SIZE bytes as long as
+ * the unit doesn't cross a FLASH_PROGRAM_PAGE_MAX_SIZE boundary. The remaining
+ * length is a multiple of the sector page size, so is every unit.
+ *
+ * \return STATUS_SUCCESS is OK, others are not ok
+ */
+static uint32_t Fls_Flash_BurstWrite( void )
+{
+	uint32_t u32Unit;
+
+	/* largest unit up to the next program boundary */
+	u32Unit = FLASH_PROGRAM_PAGE_MAX_SIZE -
+	          ((uint32_t)Fls_Flash_pTargetAddressPtr & (FLASH_PROGRAM_PAGE_MAX_SIZE - 1U));
+	if (u32Unit > Fls_u32LLDRemainingDataToWrite)
+	{
+		u32Unit = Fls_u32LLDRemainingDataToWrite;
+	}
+
+	Fls_u32LLDRemainingDataToWrite -= u32Unit;
+
+	return Fls_Flash_PageWrite(u32Unit);
 }
 
 void  Fls_Flash_MainFunctionErase( void )
 {
 	uint32_t u32Temp;
     /* if erase finished */
-    u32Temp = FLASHDRIVER_LL_HVStatusCheck();
+    u32Temp = FLASHDRIVER_HVPoll();
     /* check if finished */
     if (u32Temp == STATUS_HVOP)
     {
 
+    }
+    else if (u32Temp != STATUS_SUCCESS)
+    {
+        /* erase didn't finish in time */
+        Fls_Flash_bBlockErase = (boolean)FALSE;
+        Fls_eLLDJob = FLASH_JOB_NONE;
+        Fls_eLLDIrqJob = FLASH_IRQ_JOB_NONE;
+        Fls_eLLDJobResult = MEMIF_JOB_FAILED;
     }
     else
     {
-    	u32Temp = FLASHDRIVER_LL_EraseSectorClear();
+        if ((boolean)TRUE == Fls_Flash_bBlockErase)
+        {
+            u32Temp = FLASHDRIVER_LL_EraseBlockClear();
+        }
+        else
+        {
+            u32Temp = FLASHDRIVER_LL_EraseSectorClear();
+        }
+
     	if (u32Temp == STATUS_SUCCESS)
     	{
             /* erase operation succeed */
-            Fls_u32JobSectorIt++;   /* The sector was successfully erased, increment the sector iterator.*/
+            if ((boolean)TRUE == Fls_Flash_bBlockErase)
+            {
+                /* The whole bank was erased, move past its last sector */
+                Fls_u32JobSectorIt = Fls_Flash_u32BlockEraseLast + 1UL;
+            }
+            else
+            {
+                Fls_u32JobSectorIt++;   /* The sector was successfully erased, increment the sector iterator.*/
+            }
 
+            Fls_Flash_bBlockErase = (boolean)FALSE;
             Fls_eLLDJob = FLASH_JOB_NONE;
+            Fls_eLLDIrqJob = FLASH_IRQ_JOB_NONE;
             Fls_eLLDJobResult = MEMIF_JOB_OK;
     	}
     	else
     	{
+            Fls_Flash_bBlockErase = (boolean)FALSE;
             Fls_eLLDJob = FLASH_JOB_NONE;
+            Fls_eLLDIrqJob = FLASH_IRQ_JOB_NONE;
             Fls_eLLDJobResult = MEMIF_JOB_FAILED;
     	}
     }
@@ -910,68 +1232,286 @@ void  Fls_Flash_MainFunctionErase( void )
 
 void Fls_Flash_MainFunctionWrite( void )
 {
-    uint32_t u32DataSectorPageSize = 0UL;
     uint32_t u32Temp;
-    /* if write finished */
-    u32Temp = FLASHDRIVER_LL_HVStatusCheck();
-    /* check if finished */
-    if (u32Temp == STATUS_HVOP)
-    {
+    uint32_t u32Units = 0UL;
 
-    }
-    else
+    /* chain further burst units in this cycle as long as the previous one
+       has already completed */
+    while ((FLASH_JOB_WRITE == Fls_eLLDJob) && (u32Units < FLS_MAX_PROGRAM_UNITS_PER_CYCLE))
     {
-    	u32Temp = FLASHDRIVER_LL_ProgramClear();
-		if(u32Temp == STATUS_SUCCESS)
-		{
-            /* more page program operation to be performed? */
-            if(Fls_Flash_u32ProgramCycle<Fls_Flash_u32DoubleWordToCopy)
-            {
-                /* execute page programming */
-
-                /*
-                * @violates @ref fls_flash_c_REF_10 Array indexing shall be the
-                * only allowed form of pointer arithmetic
-                */
-                Fls_Flash_PageWrite((*(Fls_pConfigPtr->paSectorPageSize))[Fls_u32JobSectorIt]);
-                Fls_Flash_u32ProgramCycle++;
-                u32DataSectorPageSize = (*(Fls_pConfigPtr->paSectorPageSize))[Fls_u32JobSectorIt];
-                Fls_u32LLDRemainingDataToWrite -= u32DataSectorPageSize;
-
-                Fls_eLLDJob = FLASH_JOB_WRITE;
-                Fls_eLLDJobResult = MEMIF_JOB_PENDING;
-            }
-            else
-            {
-                /* all page program operations succeed */
+        u32Units++;
 
-                /* For a Write Job in ASYNC mode check if Fls_u32JobSectorIt should be increased */
-                if( (Fls_u32JobAddrIt > ((*(Fls_pConfigPtr->paSectorEndAddr))[Fls_u32JobSectorIt]) ))
-                {
-                    /* Move on to the next sector */
-                    Fls_u32JobSectorIt++;
-                }
+        /* if write finished */
+        u32Temp = FLASHDRIVER_HVPoll();
+        /* check if finished */
+        if (u32Temp == STATUS_HVOP)
+        {
+            /* unit still programming, check again in next cycle */
+            break;
+        }
+
+        if (u32Temp == STATUS_SUCCESS)
+        {
+            /* unit finished in time, check its result */
+            u32Temp = FLASHDRIVER_LL_ProgramClear();
+        }
 
-                /* program operation succeed */
+        if(u32Temp != STATUS_SUCCESS)
+        {
+            /* program operation failed or timed out */
+            Fls_eLLDJob = FLASH_JOB_NONE;
+            Fls_eLLDIrqJob = FLASH_IRQ_JOB_NONE;
+            Fls_eLLDJobResult = MEMIF_JOB_FAILED;
+        }
+        /* more program operation to be performed? */
+        else if(Fls_u32LLDRemainingDataToWrite > 0UL)
+        {
+            /* execute next burst unit */
+            if (Fls_Flash_BurstWrite() != STATUS_SUCCESS)
+            {
                 Fls_eLLDJob = FLASH_JOB_NONE;
-                Fls_eLLDJobResult = MEMIF_JOB_OK;
+                Fls_eLLDIrqJob = FLASH_IRQ_JOB_NONE;
+                Fls_eLLDJobResult = MEMIF_JOB_FAILED;
             }
-		}
+        }
         else
         {
-            /* program operation was not successful */
+            /* all program operations succeed */
 
-            /* program operation failed */
+            /* For a Write Job in ASYNC mode check if Fls_u32JobSectorIt should be increased */
+            if( (Fls_u32JobAddrIt > ((*(Fls_pConfigPtr->paSectorEndAddr))[Fls_u32JobSectorIt]) ))
+            {
+                /* Move on to the next sector */
+                Fls_u32JobSectorIt++;
+            }
+
+            /* program operation succeed */
             Fls_eLLDJob = FLASH_JOB_NONE;
-            Fls_eLLDJobResult = MEMIF_JOB_FAILED;
-            /* return */
+            Fls_eLLDIrqJob = FLASH_IRQ_JOB_NONE;
+            Fls_eLLDJobResult = MEMIF_JOB_OK;
+        }
+    }
+}
+
+/**
+ * \brief Initialize the internal flash channel
+ *
+ * \return E_OK when the ROM driver entries are present and all sectors are
+ *         locked, E_NOT_OK otherwise
+ */
+Std_ReturnType Fls_Flash_Init( void )
+{
+    Std_ReturnType u8RetVal = (Std_ReturnType)E_OK;
+
+#if (FLS_CALL_COUNTERS == STD_ON)
+    s_tFlashCallCounters = s_tFlashCallCountersReset;
+#endif
+
+    /* resolve the ROM entry points once instead of per call */
+    FLASHDRIVER_ResolveRomApi();
+
+    /* start with all sectors locked */
+    s_au32FlashLockMask[0U] = 0xFFFFFFFFU;
+    s_au32FlashLockMask[1U] = 0xFFFFFFFFU;
+    FMC->FB_FPELCK[0U] = 0xFFFFFFFFU;
+    FMC->FB_FPELCK[1U] = 0xFFFFFFFFU;
+    FLASHDRIVER_COUNT(u32LockWrites);
+    FLASHDRIVER_COUNT(u32LockWrites);
+
+    if ((0UL == s_tFlashRomApi.u32EraseBlock) || (0UL == s_tFlashRomApi.u32EraseBlockClear) ||
+        (0UL == s_tFlashRomApi.u32EraseSector) || (0UL == s_tFlashRomApi.u32EraseSectorClear) ||
+        (0UL == s_tFlashRomApi.u32Program) || (0UL == s_tFlashRomApi.u32ProgramClear) ||
+        (0UL == s_tFlashRomApi.u32HVStatusCheck))
+    {
+        /* no ROM flash driver at FLASHDRV_ADDR */
+        u8RetVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else if ((0xFFFFFFFFU != FMC->FB_FPELCK[0U]) || (0xFFFFFFFFU != FMC->FB_FPELCK[1U]))
+    {
+        /* the lock registers didn't take the value, the flash controller is not accessible */
+        u8RetVal = (Std_ReturnType)E_NOT_OK;
+    }
+    else
+    {
+        /* ready for erase and program */
+    }
+
+    return u8RetVal;
+}
+
+/**
+ * \brief Relock the sectors unlocked by the ended erase or write job
+ */
+void Fls_Flash_LockSectors( void )
+{
+    FLS_FLASH_IRQ_DISABLE();
+    FLASHDRIVER_LockAll();
+}
+
+#if (FLS_CALL_COUNTERS == STD_ON)
+/**
+ * \brief Get the lock register writes and ROM calls counted since Fls_Flash_Init
+ *
+ * \param pCounters destination of the counters
+ */
+void Fls_Flash_GetCallCounters( Fls_Flash_CallCountersType * pCounters )
+{
+    *pCounters = s_tFlashCallCounters;
+}
+#endif
+
+/**
+ * \brief Get the suspend capabilities of the flash array
+ *
+ * \return pointer to the array description
+ */
+const Fls_Flash_ArrayInfoType * Fls_Flash_GetArrayInfo( void )
+{
+    return &Fls_Flash_tArrayInfo;
+}
+
+/**
+ * \brief Get the flash bank a sector belongs to
+ *
+ * A bank can be read while the other bank is being erased or programmed.
+ *
+ * \param ePhySector physical sector
+ * \return FLASH_BLOCK_SELECT0 or FLASH_BLOCK_SELECT1
+ */
+uint32_t Fls_Flash_GetBank( const Fls_PhysicalSectorType ePhySector )
+{
+    uint32_t u32Address;
+
+    u32Address = (uint32_t)((*((*(Fls_pConfigPtr->pSectorList))[ePhySector])).pSectorStartAddressPtr);
+
+    return (u32Address <= FLASH_BANK0_END) ? FLASH_BLOCK_SELECT0 : FLASH_BLOCK_SELECT1;
+}
+
+/**
+ * \brief Suspend the ongoing sector erase so that the array can be read
+ *
+ * \return FLASH_E_OK when the erase is suspended, FLASH_E_FAILED when the array
+ *         can't suspend an erase
+ */
+Fls_LLDReturnType Fls_Flash_EraseSuspend( void )
+{
+    /* the ROM driver has no suspend entry, the array info reports it and the
+       erase keeps going until the HV operation is finished */
+    return FLASH_E_FAILED;
+}
+
+/**
+ * \brief Resume the sector erase suspended by Fls_Flash_EraseSuspend
+ *
+ * \return FLASH_E_OK when the erase continues, FLASH_E_FAILED otherwise
+ */
+Fls_LLDReturnType Fls_Flash_EraseResume( void )
+{
+    /* nothing can have been suspended without a ROM suspend entry */
+    return FLASH_E_FAILED;
+}
+
+/**
+ * \brief Check whether a run of physical sectors makes up a whole flash bank
+ *
+ * \param ePhySectorFirst first physical sector of the run
+ * \param ePhySectorLast last physical sector of the run
+ * \return TRUE when the run is contiguous and spans the bank from base to end
+ */
+boolean Fls_Flash_IsWholeBank( const Fls_PhysicalSectorType ePhySectorFirst, const Fls_PhysicalSectorType ePhySectorLast )
+{
+    boolean bRetVal = (boolean)FALSE;
+    uint32_t u32First;
+    uint32_t u32Last;
+    uint32_t u32Base;
+
+    u32First = (uint32_t)((*((*(Fls_pConfigPtr->pSectorList))[ePhySectorFirst])).pSectorStartAddressPtr);
+    u32Last = (uint32_t)((*((*(Fls_pConfigPtr->pSectorList))[ePhySectorLast])).pSectorStartAddressPtr);
+    u32Base = (FLASH_BLOCK_SELECT0 == Fls_Flash_GetBank(ePhySectorFirst)) ? 0UL : FLASH_BANK1_BASE;
+
+    if ((ePhySectorLast > ePhySectorFirst) &&
+        (u32First == u32Base) &&
+        ((u32Last + FLASH_ERASE_SECTOR_SIZE) == (u32Base + FLASH_BANK_SIZE)) &&
+        (((u32Last - u32First) / FLASH_ERASE_SECTOR_SIZE) == (ePhySectorLast - ePhySectorFirst)))
+    {
+        /* one sector per index from the bank base up to the bank end */
+        bRetVal = (boolean)TRUE;
+    }
+
+    return bRetVal;
+}
+
+#if (FLS_BLOCK_ERASE == STD_ON)
+/**
+ * \brief Check whether every sector of a run is configured to be unlocked
+ *
+ * \param ePhySectorFirst first physical sector of the run
+ * \param ePhySectorLast last physical sector of the run
+ * \return TRUE when no sector of the run is configured locked
+ */
+static boolean Fls_Flash_IsUnlockConfigured( const Fls_PhysicalSectorType ePhySectorFirst, const Fls_PhysicalSectorType ePhySectorLast )
+{
+    boolean bRetVal = (boolean)TRUE;
+    Fls_PhysicalSectorType ePhySector;
+
+    for (ePhySector = ePhySectorFirst; (ePhySector <= ePhySectorLast) && ((boolean)TRUE == bRetVal); ePhySector++)
+    {
+        if (0U == (*(Fls_pConfigPtr->paSectorUnlock))[ePhySector])
+        {
+            /* the sector stays protected, no block erase over it */
+            bRetVal = (boolean)FALSE;
         }
     }
+
+    return bRetVal;
 }
+#endif
 
-void Fls_Flash_Init( void )
+/**
+ * \brief Erase a whole flash bank with a single block erase command
+ *
+ * Only the configured sectors of the run are unlocked, the caller checks
+ * with Fls_Flash_IsUnlockConfigured that none of them is configured locked.
+ * Completion is polled by Fls_Flash_MainFunctionErase, which moves the sector
+ * iterator past ePhySectorLast.
+ *
+ * \param ePhySectorFirst first physical sector of the bank
+ * \param ePhySectorLast last physical sector of the bank
+ * \return FLASH_E_PENDING when the erase is started, FLASH_E_FAILED otherwise
+ */
+Fls_LLDReturnType Fls_Flash_BlockErase(const Fls_PhysicalSectorType ePhySectorFirst, const Fls_PhysicalSectorType ePhySectorLast)
 {
+    Fls_LLDReturnType eRetVal = FLASH_E_PENDING;
+    Fls_PhysicalSectorType ePhySector;
+    uint32_t u32Bank;
+    uint32_t u32Temp;
+
+    u32Bank = Fls_Flash_GetBank(ePhySectorFirst);
 
+    /* unlock the sectors of the run, one at a time */
+    for (ePhySector = ePhySectorFirst; ePhySector <= ePhySectorLast; ePhySector++)
+    {
+        (void)FLASHDRIVER_LockSector((uint32_t)((*((*(Fls_pConfigPtr->pSectorList))[ePhySector])).pSectorStartAddressPtr), 0U);
+    }
+
+    Fls_Flash_bBlockErase = (boolean)TRUE;
+    Fls_Flash_u32BlockEraseLast = ePhySectorLast;
+
+    /* schedule async job check for Fls_Flash_MainFunction, or Fls_IrqHandler on IRQ mode sectors */
+    Fls_Flash_JobStart(ePhySectorFirst, FLASH_JOB_ERASE, FLASH_IRQ_JOB_ERASE);
+    FLASHDRIVER_HVDeadlineStart(FLS_ERASE_TIMEOUT_US * ((ePhySectorLast - ePhySectorFirst) + 1UL));
+
+    /* start erase */
+    u32Temp = FLASHDRIVER_LL_EraseBlock(u32Bank);
+
+    if (u32Temp != STATUS_SUCCESS)
+    {
+        Fls_Flash_bBlockErase = (boolean)FALSE;
+        Fls_Flash_JobStartFailed();
+        eRetVal = FLASH_E_FAILED;
+    }
+
+    return eRetVal;
 }
 
 Fls_LLDReturnType Fls_Flash_SectorErase(const Fls_PhysicalSectorType ePhySector, const boolean bAsynch)
@@ -983,6 +1523,11 @@ Fls_LLDReturnType Fls_Flash_SectorErase(const Fls_PhysicalSectorType ePhySector,
 	Fls_Flash_pTargetAddressPtr = (*((*(Fls_pConfigPtr->pSectorList))[ePhySector])).pSectorStartAddressPtr;
     FLASHDRIVER_LockSector((uint32_t)Fls_Flash_pTargetAddressPtr, 0U);
     FLASHDRIVER_GetFlashConfig((uint32_t)Fls_Flash_pTargetAddressPtr, &tFlash_api_cfg);
+
+    /* schedule async job check for Fls_Flash_MainFunction, or Fls_IrqHandler on IRQ mode sectors */
+    Fls_Flash_JobStart(ePhySector, FLASH_JOB_ERASE, FLASH_IRQ_JOB_ERASE);
+    FLASHDRIVER_HVDeadlineStart(FLS_ERASE_TIMEOUT_US);
+
     /* start erase */
     u32Temp = FLASHDRIVER_LL_EraseSector(&tFlash_api_cfg);
 
@@ -992,14 +1537,11 @@ Fls_LLDReturnType Fls_Flash_SectorErase(const Fls_PhysicalSectorType ePhySector,
     /* check erase operation valid */
     if (tRetVal != FLASH_ERROR_OK)
     {
+        Fls_Flash_JobStartFailed();
         return FLASH_E_FAILED;
     }
     else
     {
-        /* schedule async job check for Fls_Flash_MainFunction */
-        Fls_eLLDJob = FLASH_JOB_ERASE;
-        Fls_eLLDJobResult = MEMIF_JOB_PENDING;
-
         /*
         * @violates @ref fls_flash_c_REF_6 Return statement before end of function.
         */
@@ -1012,7 +1554,7 @@ Fls_LLDReturnType Fls_Flash_SectorErase(const Fls_PhysicalSectorType ePhySector,
 Fls_LLDReturnType Fls_Flash_SectorWrite(const Fls_PhysicalSectorType ePhySector, const Fls_AddressType u32SectorOffset,
 		                                const Fls_LengthType  u32DataLength, const uint8_t * const pDataPtr, const boolean bAsynch)
 {
-	uint32_t u32DataSectorPageSize = 0UL;
+	Fls_LLDReturnType eRetVal = FLASH_E_PENDING;
 	UNUSED(bAsynch);
     /*
     * @violates @ref fls_flash_c_REF_2 A cast should not be performed
@@ -1027,27 +1569,99 @@ Fls_LLDReturnType Fls_Flash_SectorWrite(const Fls_PhysicalSectorType ePhySector,
 
     Fls_u32LLDRemainingDataToWrite = u32DataLength;
 
-    /* Number of double words (i.e.64bits=8bytes) to be copied  */
-    /*
-    * @violates @ref fls_flash_c_REF_10 Array indexing shall be the
-    * only allowed form of pointer arithmetic
-    */
-    Fls_Flash_u32DoubleWordToCopy = u32DataLength/(*(Fls_pConfigPtr->paSectorPageSize))[Fls_u32JobSectorIt];
-    Fls_Flash_u32ProgramCycle = 0U;
-
-	/*It is time to do word or double word programming */
-	Fls_Flash_PageWrite((*(Fls_pConfigPtr->paSectorPageSize))[Fls_u32JobSectorIt]);
-	Fls_Flash_u32ProgramCycle++;
-	u32DataSectorPageSize = (*(Fls_pConfigPtr->paSectorPageSize))[Fls_u32JobSectorIt];
-	Fls_u32LLDRemainingDataToWrite -= u32DataSectorPageSize;
-
-	Fls_eLLDJob = FLASH_JOB_WRITE;
-	Fls_eLLDJobResult = MEMIF_JOB_PENDING;
-
-	/*
-	* @violates @ref fls_flash_c_REF_6 Return statement before end of function.
-	*/
-	return FLASH_E_PENDING;
+	/* schedule async job check for Fls_Flash_MainFunction, or Fls_IrqHandler on IRQ mode sectors */
+	Fls_Flash_JobStart(ePhySector, FLASH_JOB_WRITE, FLASH_IRQ_JOB_WRITE);
+
+	/* Program the first burst unit, the rest is chained by Fls_Flash_MainFunctionWrite */
+	if (Fls_Flash_BurstWrite() != STATUS_SUCCESS)
+	{
+		Fls_Flash_JobStartFailed();
+		eRetVal = FLASH_E_FAILED;
+	}
+
+	return eRetVal;
+}
+
+/**
+ * \brief Compare flash content with a data buffer
+ *
+ * Works a word at a time whenever flash and buffer share the same alignment
+ * within a word, byte-wise for the unaligned head and tail.
+ *
+ * \param pFlashPtr mapped flash address
+ * \param pDataPtr data buffer
+ * \param u32Length number of bytes
+ * \return TRUE if all bytes are equal
+ */
+static boolean Fls_Flash_IsEqual( const volatile uint8 * pFlashPtr, const uint8 * pDataPtr, uint32_t u32Length )
+{
+    uint32_t u32Index = 0UL;
+    boolean bEqual = (boolean)TRUE;
+
+    if (0UL == (((uint32_t)pFlashPtr ^ (uint32_t)pDataPtr) & 3UL))
+    {
+        /* bytes up to the word boundary */
+        while ((u32Index < u32Length) && (0UL != (((uint32_t)pFlashPtr + u32Index) & 3UL)) && ((boolean)TRUE == bEqual))
+        {
+            bEqual = (pFlashPtr[u32Index] == pDataPtr[u32Index]) ? (boolean)TRUE : (boolean)FALSE;
+            u32Index++;
+        }
+
+        /* word-wide on the common alignment */
+        while (((u32Index + 4UL) <= u32Length) && ((boolean)TRUE == bEqual))
+        {
+            bEqual = (*((const volatile uint32_t *)&pFlashPtr[u32Index]) == *((const uint32_t *)&pDataPtr[u32Index])) ?
+                     (boolean)TRUE : (boolean)FALSE;
+            u32Index += 4UL;
+        }
+    }
+
+    /* remaining bytes, or all of them when flash and buffer aren't aligned alike */
+    while ((u32Index < u32Length) && ((boolean)TRUE == bEqual))
+    {
+        bEqual = (pFlashPtr[u32Index] == pDataPtr[u32Index]) ? (boolean)TRUE : (boolean)FALSE;
+        u32Index++;
+    }
+
+    return bEqual;
+}
+
+/**
+ * \brief Check that flash content is erased
+ *
+ * Works a word at a time between the unaligned head and tail bytes.
+ *
+ * \param pFlashPtr mapped flash address
+ * \param u32Length number of bytes
+ * \return TRUE if all bytes are erased
+ */
+static boolean Fls_Flash_IsBlank( const volatile uint8 * pFlashPtr, uint32_t u32Length )
+{
+    uint32_t u32Index = 0UL;
+    boolean bBlank = (boolean)TRUE;
+
+    /* bytes up to the word boundary */
+    while ((u32Index < u32Length) && (0UL != (((uint32_t)pFlashPtr + u32Index) & 3UL)) && ((boolean)TRUE == bBlank))
+    {
+        bBlank = (FLS_FLASH_ERASED_BYTE == pFlashPtr[u32Index]) ? (boolean)TRUE : (boolean)FALSE;
+        u32Index++;
+    }
+
+    /* word-wide */
+    while (((u32Index + 4UL) <= u32Length) && ((boolean)TRUE == bBlank))
+    {
+        bBlank = (FLS_FLASH_ERASED_WORD == *((const volatile uint32_t *)&pFlashPtr[u32Index])) ? (boolean)TRUE : (boolean)FALSE;
+        u32Index += 4UL;
+    }
+
+    /* tail bytes */
+    while ((u32Index < u32Length) && ((boolean)TRUE == bBlank))
+    {
+        bBlank = (FLS_FLASH_ERASED_BYTE == pFlashPtr[u32Index]) ? (boolean)TRUE : (boolean)FALSE;
+        u32Index++;
+    }
+
+    return bBlank;
 }
 
 Fls_LLDReturnType  Fls_Flash_SectorRead (const Fls_PhysicalSectorType ePhySector, const Fls_AddressType u32SectorOffset, Fls_LengthType u32DataLength,
@@ -1069,3 +1683,97 @@ Fls_LLDReturnType  Fls_Flash_SectorRead (const Fls_PhysicalSectorType ePhySector
     return eRetVal;
 }
 
+Fls_LLDReturnType Fls_Flash_SectorCompare(const Fls_PhysicalSectorType ePhySector, const Fls_AddressType u32SectorOffset,
+                                          Fls_LengthType u32DataLength, const uint8 * pDataPtr)
+{
+    Fls_LLDReturnType eRetVal = FLASH_E_OK;
+
+    /* Compare directly on the mapped flash, no copy to RAM */
+    Fls_Flash_pReadAddressPtr = (volatile const uint8 *)((*((*(Fls_pConfigPtr->pSectorList))[ePhySector])).pSectorStartAddressPtr) + \
+                              u32SectorOffset;
+
+    if ((boolean)FALSE == Fls_Flash_IsEqual(Fls_Flash_pReadAddressPtr, pDataPtr, u32DataLength))
+    {
+        eRetVal = FLASH_E_BLOCK_INCONSISTENT;
+    }
+
+    return eRetVal;
+}
+
+Fls_LLDReturnType Fls_Flash_SectorBlankCheck(const Fls_PhysicalSectorType ePhySector, const Fls_AddressType u32SectorOffset,
+                                             Fls_LengthType u32DataLength)
+{
+    Fls_LLDReturnType eRetVal = FLASH_E_OK;
+
+    Fls_Flash_pReadAddressPtr = (volatile const uint8 *)((*((*(Fls_pConfigPtr->pSectorList))[ePhySector])).pSectorStartAddressPtr) + \
+                              u32SectorOffset;
+
+    if ((boolean)FALSE == Fls_Flash_IsBlank(Fls_Flash_pReadAddressPtr, u32DataLength))
+    {
+        eRetVal = FLASH_E_BLOCK_INCONSISTENT;
+    }
+
+    return eRetVal;
+}
+
+/**
+ * \brief Erase channel operation of the internal flash
+ *
+ * Erases the whole bank with one block erase command when the sectors from
+ * ePhySector to ePhySectorLast make up a bank and none of them is configured
+ * locked, else the single sector.
+ *
+ * \param ePhySector physical sector to erase
+ * \param ePhySectorLast last physical sector of the job on this channel
+ * \param bAsynch asynchronous operation
+ * \return FLASH_E_PENDING when the erase is started, FLASH_E_FAILED otherwise
+ */
+static Fls_LLDReturnType Fls_Flash_Erase(const Fls_PhysicalSectorType ePhySector, const Fls_PhysicalSectorType ePhySectorLast,
+                                         const boolean bAsynch)
+{
+    Fls_LLDReturnType eRetVal;
+
+#if (FLS_BLOCK_ERASE == STD_ON)
+    if (((boolean)TRUE == Fls_Flash_IsWholeBank(ePhySector, ePhySectorLast)) &&
+        ((boolean)TRUE == Fls_Flash_IsUnlockConfigured(ePhySector, ePhySectorLast)))
+    {
+        eRetVal = Fls_Flash_BlockErase(ePhySector, ePhySectorLast);
+    }
+    else
+#else
+    UNUSED(ePhySectorLast);
+#endif
+    {
+        eRetVal = Fls_Flash_SectorErase(ePhySector, bAsynch);
+    }
+
+    return eRetVal;
+}
+
+/**
+ * \brief Check whether the flash array can suspend an erase
+ *
+ * \return TRUE when the ROM driver provides erase suspend
+ */
+static boolean Fls_Flash_EraseSuspendPossible( void )
+{
+    return Fls_Flash_tArrayInfo.bEraseSuspPossible;
+}
+
+/** \brief Backend operations of the internal flash channel, see Fls_ConfigType::paChannelOps */
+const Fls_ChannelOpsType Fls_Flash_tChannelOps =
+{
+    &Fls_Flash_Init,                    /* pfInit */
+    &Fls_Flash_Erase,                   /* pfErase */
+    &Fls_Flash_SectorWrite,             /* pfWrite */
+    &Fls_Flash_SectorRead,              /* pfRead */
+    &Fls_Flash_SectorCompare,           /* pfCompare */
+    &Fls_Flash_SectorBlankCheck,        /* pfBlankCheck */
+    &Fls_Flash_MainFunctionErase,       /* pfMainFunctionErase */
+    &Fls_Flash_MainFunctionWrite,       /* pfMainFunctionWrite */
+    &Fls_Flash_LockSectors,             /* pfLockSectors */
+    &Fls_Flash_EraseSuspendPossible,    /* pfEraseSuspendPossible */
+    &Fls_Flash_EraseSuspend,            /* pfEraseSuspend */
+    &Fls_Flash_EraseResume,             /* pfEraseResume */
+    &Fls_Flash_GetBank                  /* pfGetBank */
+};
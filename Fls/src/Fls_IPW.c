@@ -7,87 +7,203 @@
 #include "Fls.h"
 #include "Fls_IPW.h"
 #include "Fls_Flash.h"
-/*
+/**
+* @brief          Get the backend operations of a sector.
+* @details        The channel of the sector (internal, external, simulation) selects
+*                 the operations table from the configuration.
+*/
+LOCAL_INLINE const Fls_ChannelOpsType * Fls_IPW_GetChannelOps( const Fls_SectorIndexType u32SectorIt )
+{
+    return (*(Fls_pConfigPtr->paChannelOps))[(*(Fls_pConfigPtr->paHwCh))[u32SectorIt]];
+}
 
+/**
+* @brief          IP wrapper initialization function.
+* @details        Initialize the flash hardware of each configured channel. A channel
+*                 failing its initialization aborts the subsequent ones.
+*
+* @return         Std_ReturnType
+* @retval         E_OK        All configured channels are initialized
+* @retval         E_NOT_OK    A channel failed its initialization
 */
-void Fls_FC_Init(void)
+Std_ReturnType Fls_IPW_Init(void)
 {
-    /* Initialize flash hardware
-       NOTE: The variable 'Fls_eLLDJobResult' will be updated in the below function*/
-    //Fls_Flash_Init();
-	Fls_eLLDJobResult = MEMIF_JOB_OK;
-    if(MEMIF_JOB_FAILED == Fls_eLLDJobResult)
+    Std_ReturnType u8RetVal = (Std_ReturnType)E_OK;
+    uint32_t u32Ch;
+
+    for( u32Ch = 0U; (u32Ch < FLS_HW_CH_COUNT) && (((Std_ReturnType)E_OK) == u8RetVal); u32Ch++ )
     {
-        /* Error during Fls_Flash_Init, abort any subsequent IP initializations. */
-        /* @violates @ref fls_ipw_c_REF_3 Return statement before end of function. */
-        return;
+        if( NULL_PTR != (*(Fls_pConfigPtr->paChannelOps))[u32Ch] )
+        {
+            u8RetVal = (*(Fls_pConfigPtr->paChannelOps))[u32Ch]->pfInit();
+        }
     }
 
+    /* No hardware job left over from before the initialization */
+    Fls_eLLDJobResult = (((Std_ReturnType)E_OK) == u8RetVal) ? MEMIF_JOB_OK : MEMIF_JOB_FAILED;
+
+    return u8RetVal;
 }
 
 /**
 * @brief          IP wrapper sector erase function.
-* @details        Route the erase job to appropriate low level IP function. 
+* @details        Route the erase job to the backend of the sector channel. The
+*                 backend may erase the remaining sectors of the job on its
+*                 channel with one command.
 */
-Fls_LLDReturnType Fls_FC_SectorErase (const boolean bAsynch)
+Fls_LLDReturnType Fls_IPW_SectorErase (const boolean bAsynch)
 {
-    Fls_LLDReturnType eLldRetVal = FLASH_E_FAILED;
-    Fls_HwChType eHwCh;
-    UNUSED(bAsynch);
-    /* Get channel type(INTERNAL, QSPI,...) to determine the HW IP used(internal or external flash). */
-    eHwCh = (*(Fls_pConfigPtr->paHwCh))[Fls_u32JobSectorIt];
-    
-    /* Decide the IP used: internal flash or external QSPI */
-    if(FLS_CH_INTERN == eHwCh)
-    {        
-        /* Call Low-Level driver to erase one internal sector with 
-            the Fls_u32JobSectorIt sector index */    
-        eLldRetVal = Fls_Flashjogogouase( Fls_u32JobSectorIt, bAsynch );
+    Fls_SectorIndexType u32SectorLast = Fls_u32JobSectorIt;
+
+    if( (*(Fls_pConfigPtr->paHwCh))[Fls_u32JobSectorIt] == (*(Fls_pConfigPtr->paHwCh))[Fls_u32JobSectorEnd] )
+    {
+        /* Rest of the job is on the same channel */
+        u32SectorLast = Fls_u32JobSectorEnd;
     }
-    return eLldRetVal;
+
+    return Fls_IPW_GetChannelOps( Fls_u32JobSectorIt )->pfErase( Fls_u32JobSectorIt, u32SectorLast, bAsynch );
 }
 
 /**
 * @brief          IP wrapper sector write function.
-* @details        Route the write job to appropriate low level IP function.
+* @details        Route the write job to the backend of the sector channel.
 */
-Fls_LLDReturnType Fls_FC_SectorWrite (const Fls_AddressType u32SectorOffset, const Fls_AddressType u32Length,  const uint8 * pJobDataSrcPtr, const boolean bAsynch )
+Fls_LLDReturnType Fls_IPW_SectorWrite (const Fls_AddressType u32SectorOffset, const Fls_AddressType u32Length,  const uint8 * pJobDataSrcPtr, const boolean bAsynch )
 {
-    Fls_LLDReturnType eLldRetVal = FLASH_E_FAILED;
-    Fls_HwChType eHwCh;
+    return Fls_IPW_GetChannelOps( Fls_u32JobSectorIt )->pfWrite( Fls_u32JobSectorIt, u32SectorOffset, u32Length, pJobDataSrcPtr, bAsynch );
+}
+
+/**
+* @brief          IP wrapper sector read function.
+* @details        Route the read job to the backend of the sector channel.
+*/
+Fls_LLDReturnType Fls_IPW_SectorRead ( const Fls_AddressType u32SectorOffset, const Fls_AddressType u32Length, uint8 * pJobDataDestPtr)
+{
+    return Fls_IPW_GetChannelOps( Fls_u32JobSectorIt )->pfRead( Fls_u32JobSectorIt, u32SectorOffset, u32Length, pJobDataDestPtr );
+}
+
+/**
+* @brief          IP wrapper sector compare function.
+* @details        Route the compare job to the backend of the sector channel.
+*/
+Fls_LLDReturnType Fls_IPW_SectorCompare ( const Fls_AddressType u32SectorOffset, const Fls_AddressType u32Length, const uint8 * pJobDataSrcPtr)
+{
+    return Fls_IPW_GetChannelOps( Fls_u32JobSectorIt )->pfCompare( Fls_u32JobSectorIt, u32SectorOffset, u32Length, pJobDataSrcPtr );
+}
+
+/**
+* @brief          IP wrapper sector blank check function.
+* @details        Route the blank check job to the backend of the sector channel.
+*/
+Fls_LLDReturnType Fls_IPW_SectorBlankCheck ( const Fls_AddressType u32SectorOffset, const Fls_AddressType u32Length)
+{
+    return Fls_IPW_GetChannelOps( Fls_u32JobSectorIt )->pfBlankCheck( Fls_u32JobSectorIt, u32SectorOffset, u32Length );
+}
+
+/**
+* @brief          IP wrapper job end function.
+* @details        Relock the sectors unlocked by the ended erase or write job on
+*                 every channel with sector locking.
+*/
+void Fls_IPW_LockSectors( void )
+{
+    uint32_t u32Ch;
+    const Fls_ChannelOpsType * pOps;
 
-    UNUSED(bAsynch);
-    /* Get channel type(INTERNAL, QSPI,...) to determine the HW IP used(internal or external flash). */
-    eHwCh = (*(Fls_pConfigPtr->paHwCh))[Fls_u32JobSectorIt];
+    for( u32Ch = 0U; u32Ch < FLS_HW_CH_COUNT; u32Ch++ )
+    {
+        pOps = (*(Fls_pConfigPtr->paChannelOps))[u32Ch];
+
+        if( (NULL_PTR != pOps) && (NULL_PTR != pOps->pfLockSectors) )
+        {
+            pOps->pfLockSectors();
+        }
+    }
+}
+
+/**
+* @brief          IP wrapper erase suspend capability.
+* @details        Check whether the flash of the sector being erased can suspend the erase.
+*/
+boolean Fls_IPW_EraseSuspendPossible( void )
+{
+    boolean bRetVal = (boolean)FALSE;
+    const Fls_ChannelOpsType * pOps = Fls_IPW_GetChannelOps( Fls_u32JobSectorIt );
 
-    /* Decide the IP used: internal flash or external QSPI */
-    if(FLS_CH_INTERN == eHwCh)
+    if( (NULL_PTR != pOps->pfEraseSuspendPossible) && (NULL_PTR != pOps->pfEraseSuspend) )
     {
-        eLldRetVal = Fls_Flash_SectorWrite( Fls_u32JobSectorIt, u32SectorOffset, u32Length, pJobDataSrcPtr, bAsynch );
+        bRetVal = pOps->pfEraseSuspendPossible();
     }
 
-    return eLldRetVal;
+    return bRetVal;
 }
 
-/*
+/**
+* @brief          IP wrapper erase suspend function.
+* @details        Route the erase suspend to the backend of the sector channel.
 */
-Fls_LLDReturnType Fls_FC_SectorRead ( const Fls_AddressType u32SectorOffset, const Fls_AddressType u32Length, uint8 * pJobDataDestPtr)
+Fls_LLDReturnType Fls_IPW_EraseSuspend( void )
 {
     Fls_LLDReturnType eLldRetVal = FLASH_E_FAILED;
-    Fls_HwChType eHwCh;
+    const Fls_ChannelOpsType * pOps = Fls_IPW_GetChannelOps( Fls_u32JobSectorIt );
+
+    if( NULL_PTR != pOps->pfEraseSuspend )
+    {
+        eLldRetVal = pOps->pfEraseSuspend();
+    }
+
+    return eLldRetVal;
+}
 
-    /* Get channel type(INTERNAL, QSPI,...) to determine the HW IP used(internal or external flash). */
-    eHwCh = (*(Fls_pConfigPtr->paHwCh))[Fls_u32JobSectorIt];
+/**
+* @brief          IP wrapper erase resume function.
+* @details        Route the erase resume to the backend of the sector channel.
+*/
+Fls_LLDReturnType Fls_IPW_EraseResume( void )
+{
+    Fls_LLDReturnType eLldRetVal = FLASH_E_FAILED;
+    const Fls_ChannelOpsType * pOps = Fls_IPW_GetChannelOps( Fls_u32JobSectorIt );
 
-    /* Decide the IP used: internal flash or external QSPI */
-    if(FLS_CH_INTERN == eHwCh)
+    if( NULL_PTR != pOps->pfEraseResume )
     {
-        eLldRetVal = Fls_Flash_SectorRead( FlyfyiyyrIt, u32SectorOffset, u32Length, pJobDataDestPtr );
+        eLldRetVal = pOps->pfEraseResume();
     }
 
     return eLldRetVal;
 }
 
+/**
+* @brief          IP wrapper read-while-write capability.
+* @details        Check whether the sectors of a read job can be read while the
+*                 sector of the running erase or write hardware job is busy,
+*                 i.e. all are on the same channel with banks and the read is
+*                 on another bank.
+*/
+boolean Fls_IPW_ReadWhileWritePossible( const Fls_SectorIndexType u32ReadSectorIt, const Fls_SectorIndexType u32ReadSectorEnd )
+{
+    boolean bRetVal = (boolean)FALSE;
+    const Fls_ChannelOpsType * pOps = Fls_IPW_GetChannelOps( Fls_u32JobSectorIt );
+    uint32_t u32Bank;
+
+    if( (NULL_PTR != pOps->pfGetBank) &&
+        (pOps == Fls_IPW_GetChannelOps( u32ReadSectorIt )) &&
+        (pOps == Fls_IPW_GetChannelOps( u32ReadSectorEnd ))
+      )
+    {
+        u32Bank = pOps->pfGetBank( Fls_u32JobSectorIt );
+
+        if( (u32Bank != pOps->pfGetBank( u32ReadSectorIt )) &&
+            (u32Bank != pOps->pfGetBank( u32ReadSectorEnd ))
+          )
+        {
+            /* Both ends of the read are on the other bank, and so is everything in between */
+            bRetVal = (boolean)TRUE;
+        }
+    }
+
+    return bRetVal;
+}
+
 /**
 * @brief          Process ongoing erase or write hardware job.
 * @details        In case Async Operation is ongoing this function will complete the following job:
@@ -104,32 +220,19 @@ Fls_LLDReturnType Fls_FC_SectorRead ( const Fls_AddressType u32SectorOffset, con
 *                 Dem_ReportErrorStatus(Fls_pConfigPtr->Fls_E_WriteFailedCfg.id, DEM_EVENT_STATUS_FAILED)
 *                 when write operation failed due to hardware error
 */
-void Fls_IPW_FCMainFunction( void )
+void Fls_IPW_LLDMainFunction( void )
 {
-    Fls_HwChType eHwCh;
-
-    /* Get channel type(INTERNAL, EXTERNAL_A1, A2,...) to determine the HW IP used(internal or external flash). */
-    eHwCh = (*(Fls_pConfigPtr->paHwCh))[Fls_u32JobSectorIt];
-
     if(MEMIF_JOB_PENDING == Fls_eLLDJobResult)
     {
         /* some hardware job (asynchronous) is pending */
         if (FLASH_JOB_ERASE == Fls_eLLDJob )
         {
-            /* Decide the IP used: internal flash or external QSPI */
-            if(FLS_CH_INTERN == eHwCh)
-            {
-                Fls_Flash_MainFunctionErase();
-            }
+            Fls_IPW_GetChannelOps( Fls_u32JobSectorIt )->pfMainFunctionErase();
         }
         /* Write hardware job (asynchronous) is pending */
         else if (FLASH_JOB_WRITE == Fls_eLLDJob )
         {
-            /* Decide the IP used: internal flash or external QSPI */
-            if(FLS_CH_INTERN == eHwCh)
-            {
-                Fls_Flash_MainFunctionWrite();
-            }
+            Fls_IPW_GetChannelOps( Fls_u32JobSectorIt )->pfMainFunctionWrite();
         }
         /* Write interleaved hardware job (asynchronous) is pending */
         else if (FLASH_JOB_NONE == Fls_eLLDJob)
@@ -0,0 +1,805 @@
+/*==================================================================================================
+*                                        INCLUDE FILES
+* 1) system and project includes
+* 2) needed interfaces from external units
+* 3) internal and external interfaces from this unit
+==================================================================================================*/
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "Fls.h"
+#include "Fls_Flash.h"
+#include "Fls_Sim.h"
+
+/*
+ * Host flash model: a timing-accurate NOR flash backend for building and profiling
+ * the Fls/Fee stack on a host without target hardware.
+ *
+ * The array is kept in the memory mapped file FLS_SIM_IMAGE_FILE, so its content
+ * survives a restart of the host process like the flash survives a reset. NOR rules
+ * are enforced: erase is sector-granular, a page can only be programmed when erased
+ * and programming only clears bits. Erase, program and read charge their latencies
+ * on a virtual clock that the host scheduler moves with Fls_Sim_AdvanceTime. An
+ * asynchronous erase or program completes in the first Fls_MainFunction call after
+ * its latency has elapsed.
+ *
+ * An erase or program on a FLS_SECTOR_IRQ_MODE sector completes in Fls_IrqHandler
+ * instead: Fls_Sim_AdvanceTime raises the simulated completion interrupt once the
+ * latency has elapsed.
+ *
+ * The banks of the model are runs of FLS_SIM_BANK_SECTORS sectors. With
+ * FLS_BLOCK_ERASE an erase job covering a bank with no sector configured locked
+ * erases it with one block erase of FLS_SIM_BLOCK_ERASE_TIME_US. Read-while-write
+ * between the banks isn't modeled. A sector erase can be suspended to read the
+ * array, the read waits FLS_SIM_SUSPEND_TIME_US for the suspend and the resumed
+ * erase takes FLS_SIM_RESUME_TIME_US longer.
+ *
+ * The model replaces Fls_Flash.c, so a host build doesn't run the lock register
+ * writes and ROM calls of the internal flash. FLS_CALL_COUNTERS counts them on the
+ * target only.
+ *
+ * A power cut can be injected at any erase or program operation boundary, and in the
+ * middle of it. The operation then never completes and the model stops working. The
+ * host resets by restarting the process (e.g. a fork per cut point): the image file
+ * keeps what was programmed up to the cut for the next Fls_Init and Fee_Init.
+ */
+#if( FLS_SIM_BACKEND == STD_ON )
+
+/* ################################################################################## */
+/* ####################################### Macro #################################### */
+
+#define FLS_SIM_ERASED_BYTE     0xFFU
+
+#define FLS_SIM_NS_PER_US       1000ULL
+
+/* ################################################################################## */
+/* ################################ Local Variables ################################# */
+
+/** mapped image of the flash array, logical address is the offset */
+static uint8 * Fls_Sim_pImage = NULL_PTR;
+static uint32 Fls_Sim_u32ImageSize = 0UL;
+static int Fls_Sim_iImageFd = -1;
+
+/** virtual clock in ns and completion time of the running erase or program */
+static uint64_t Fls_Sim_u64Now = 0ULL;
+static uint64_t Fls_Sim_u64BusyUntil = 0ULL;
+
+/** first and last sector of the running erase, erase time left while it is suspended */
+static Fls_PhysicalSectorType Fls_Sim_eEraseSector = 0UL;
+static Fls_PhysicalSectorType Fls_Sim_eEraseLast = 0UL;
+static boolean Fls_Sim_bEraseSuspended = (boolean)FALSE;
+static uint64_t Fls_Sim_u64EraseLeft = 0ULL;
+
+/** sector and image offset of the next page of the running write */
+static Fls_PhysicalSectorType Fls_Sim_eWriteSector = 0UL;
+static uint32 Fls_Sim_u32WriteOffset = 0UL;
+static const uint8 * Fls_Sim_pWriteSrc = NULL_PTR;
+
+static Fls_Sim_SectorStatsType Fls_Sim_aSectorStats[FLS_SIM_MAX_SECTORS];
+
+/** erase and program operations started since the process start */
+static uint32 Fls_Sim_u32OpCount = 0UL;
+
+/** armed power cut: operation number and bytes of it still carried out */
+static boolean Fls_Sim_bPowerFailArmed = (boolean)FALSE;
+static uint32 Fls_Sim_u32PowerFailOp = 0UL;
+static uint32 Fls_Sim_u32PowerFailBytes = 0UL;
+static boolean Fls_Sim_bPowerLost = (boolean)FALSE;
+
+/** complete operations without waiting for the virtual clock */
+static boolean Fls_Sim_bFastForward = (boolean)FALSE;
+
+/* ################################################################################## */
+/* ################################ Local Functions ################################# */
+
+/**
+ * \brief Image offset of a sector
+ *
+ * \param ePhySector physical sector
+ * \return logical start address of the sector
+ */
+static uint32 Fls_Sim_SectorOffset( const Fls_PhysicalSectorType ePhySector )
+{
+    return (uint32)((*(Fls_pConfigPtr->paSectorStartAddr))[ePhySector]);
+}
+
+/**
+ * \brief Operation counters of a sector
+ *
+ * \param ePhySector physical sector
+ * \return counters, NULL_PTR beyond FLS_SIM_MAX_SECTORS
+ */
+static Fls_Sim_SectorStatsType * Fls_Sim_Stats( const Fls_PhysicalSectorType ePhySector )
+{
+    return (ePhySector < FLS_SIM_MAX_SECTORS) ? &Fls_Sim_aSectorStats[ePhySector] : NULL_PTR;
+}
+
+/**
+ * \brief Charge the read latency of u32Length bytes on the virtual clock
+ *
+ * \param ePhySector physical sector read
+ * \param u32Length number of bytes
+ */
+static void Fls_Sim_ChargeRead( const Fls_PhysicalSectorType ePhySector, uint32 u32Length )
+{
+    Fls_Sim_SectorStatsType * pStats = Fls_Sim_Stats(ePhySector);
+
+    Fls_Sim_u64Now += (uint64_t)u32Length * FLS_SIM_READ_TIME_NS;
+
+    if (NULL_PTR != pStats)
+    {
+        pStats->u32ReadBytes += u32Length;
+    }
+}
+
+/**
+ * \brief Check whether the model can serve an operation
+ *
+ * \return TRUE when the image is mapped and power wasn't cut
+ */
+static boolean Fls_Sim_IsPowered( void )
+{
+    return ((NULL_PTR != Fls_Sim_pImage) && ((boolean)FALSE == Fls_Sim_bPowerLost)) ? (boolean)TRUE : (boolean)FALSE;
+}
+
+/**
+ * \brief Count a started erase or program operation, cut power at the armed one
+ *
+ * \param pu32Length length of the operation, reduced to the part carried out
+ *                   before the cut
+ * \return TRUE when power is cut during this operation
+ */
+static boolean Fls_Sim_PowerCut( uint32 * pu32Length )
+{
+    boolean bRetVal = (boolean)FALSE;
+
+    if (((boolean)TRUE == Fls_Sim_bPowerFailArmed) && (Fls_Sim_u32OpCount == Fls_Sim_u32PowerFailOp))
+    {
+        if (*pu32Length > Fls_Sim_u32PowerFailBytes)
+        {
+            *pu32Length = Fls_Sim_u32PowerFailBytes;
+        }
+
+        /* the operation never completes */
+        Fls_Sim_bPowerFailArmed = (boolean)FALSE;
+        Fls_Sim_bPowerLost = (boolean)TRUE;
+        Fls_Sim_u64BusyUntil = UINT64_MAX;
+        bRetVal = (boolean)TRUE;
+    }
+
+    Fls_Sim_u32OpCount++;
+
+    return bRetVal;
+}
+
+/**
+ * \brief Mark the hardware job of the operation about to be started
+ *
+ * The job is marked before the operation starts, as on the target where the
+ * start command is the last write of the task side.
+ *
+ * \param ePhySector physical sector of the operation
+ * \param eJob polled hardware job
+ * \param eIrqJob interrupt job, taken on a FLS_SECTOR_IRQ_MODE sector only
+ */
+static void Fls_Sim_JobStart( const Fls_PhysicalSectorType ePhySector, const Fls_LLDJobType eJob,
+                              const Fls_LLDIrqJobType eIrqJob )
+{
+    Fls_eLLDJob = eJob;
+    Fls_eLLDJobResult = MEMIF_JOB_PENDING;
+
+    if (0U != ((*(Fls_pConfigPtr->paSectorFlags))[ePhySector] & FLS_SECTOR_IRQ_MODE))
+    {
+        Fls_eLLDIrqJob = eIrqJob;
+    }
+    else
+    {
+        Fls_eLLDIrqJob = FLASH_IRQ_JOB_NONE;
+    }
+}
+
+/**
+ * \brief End the hardware job of the running operation
+ *
+ * \param eResult result of the hardware job
+ */
+static void Fls_Sim_JobEnd( const MemIf_JobResultType eResult )
+{
+    Fls_eLLDJob = FLASH_JOB_NONE;
+    Fls_eLLDIrqJob = FLASH_IRQ_JOB_NONE;
+    Fls_eLLDJobResult = eResult;
+}
+
+/**
+ * \brief Program the next page of the running write
+ *
+ * The page has to be erased, programming clears bits only. The page completes
+ * FLS_SIM_PROGRAM_TIME_US after the previous one.
+ *
+ * \return TRUE when the page was programmed, FALSE on a NOR rule violation
+ */
+static boolean Fls_Sim_ProgramPage( void )
+{
+    Fls_Sim_SectorStatsType * pStats = Fls_Sim_Stats(Fls_Sim_eWriteSector);
+    uint32 u32Unit = (*(Fls_pConfigPtr->paSectorPageSize))[Fls_Sim_eWriteSector];
+    boolean bRetVal = (boolean)TRUE;
+    uint32 u32Apply;
+    uint32 u32Index;
+
+    if (u32Unit > Fls_u32LLDRemainingDataToWrite)
+    {
+        u32Unit = Fls_u32LLDRemainingDataToWrite;
+    }
+
+    for (u32Index = 0UL; u32Index < u32Unit; u32Index++)
+    {
+        if (FLS_SIM_ERASED_BYTE != Fls_Sim_pImage[Fls_Sim_u32WriteOffset + u32Index])
+        {
+            /* page not erased */
+            bRetVal = (boolean)FALSE;
+        }
+    }
+
+    if ((boolean)TRUE == bRetVal)
+    {
+        u32Apply = u32Unit;
+
+        if ((boolean)FALSE == Fls_Sim_PowerCut(&u32Apply))
+        {
+            Fls_Sim_u64BusyUntil += FLS_SIM_PROGRAM_TIME_US * FLS_SIM_NS_PER_US;
+        }
+
+        for (u32Index = 0UL; u32Index < u32Apply; u32Index++)
+        {
+            Fls_Sim_pImage[Fls_Sim_u32WriteOffset + u32Index] &= Fls_Sim_pWriteSrc[u32Index];
+        }
+
+        Fls_Sim_u32WriteOffset += u32Unit;
+        Fls_Sim_pWriteSrc += u32Unit;
+        Fls_u32LLDRemainingDataToWrite -= u32Unit;
+    }
+
+    if (NULL_PTR != pStats)
+    {
+        if ((boolean)TRUE == bRetVal)
+        {
+            pStats->u32ProgramCount++;
+            pStats->u32ProgramBytes += u32Unit;
+        }
+        else
+        {
+            pStats->u32RuleViolations++;
+        }
+    }
+
+    return bRetVal;
+}
+
+/**
+ * \brief Map the image file, an added part of the image is erased
+ *
+ * \return E_OK when the image is mapped, E_NOT_OK otherwise
+ */
+static Std_ReturnType Fls_Sim_Init( void )
+{
+    struct stat tStat;
+    uint32 u32OldSize = 0UL;
+    void * pMap;
+
+    /* no erase is suspended across a reset */
+    Fls_Sim_bEraseSuspended = (boolean)FALSE;
+
+    if (NULL_PTR == Fls_Sim_pImage)
+    {
+        Fls_Sim_u32ImageSize =
+            (uint32)((*(Fls_pConfigPtr->paSectorEndAddr))[Fls_pConfigPtr->u32SectorCount - 1UL]) + 1UL;
+
+        Fls_Sim_iImageFd = open(FLS_SIM_IMAGE_FILE, O_RDWR | O_CREAT, 0644);
+
+        if (Fls_Sim_iImageFd >= 0)
+        {
+            if (0 == fstat(Fls_Sim_iImageFd, &tStat))
+            {
+                u32OldSize = ((uint32)tStat.st_size < Fls_Sim_u32ImageSize) ? (uint32)tStat.st_size : Fls_Sim_u32ImageSize;
+            }
+
+            if (0 == ftruncate(Fls_Sim_iImageFd, (off_t)Fls_Sim_u32ImageSize))
+            {
+                pMap = mmap(NULL, Fls_Sim_u32ImageSize, PROT_READ | PROT_WRITE, MAP_SHARED, Fls_Sim_iImageFd, 0);
+
+                if (MAP_FAILED != pMap)
+                {
+                    Fls_Sim_pImage = (uint8 *)pMap;
+                    /* a new image comes out of the factory erased */
+                    (void)memset(&Fls_Sim_pImage[u32OldSize], FLS_SIM_ERASED_BYTE, Fls_Sim_u32ImageSize - u32OldSize);
+                }
+            }
+
+            if (NULL_PTR == Fls_Sim_pImage)
+            {
+                (void)close(Fls_Sim_iImageFd);
+                Fls_Sim_iImageFd = -1;
+            }
+        }
+    }
+
+    return (NULL_PTR != Fls_Sim_pImage) ? (Std_ReturnType)E_OK : (Std_ReturnType)E_NOT_OK;
+}
+
+#if (FLS_BLOCK_ERASE == STD_ON)
+/**
+ * \brief Check whether a run of sectors is a bank of the model that can be block erased
+ *
+ * \param ePhySectorFirst first physical sector of the run
+ * \param ePhySectorLast last physical sector of the run
+ * \return TRUE when the run is a whole bank and no sector of it is configured locked
+ */
+static boolean Fls_Sim_IsBlockErase( const Fls_PhysicalSectorType ePhySectorFirst, const Fls_PhysicalSectorType ePhySectorLast )
+{
+    boolean bRetVal = (boolean)FALSE;
+    Fls_PhysicalSectorType ePhySector;
+
+    if ((0UL == (ePhySectorFirst % FLS_SIM_BANK_SECTORS)) &&
+        (((ePhySectorLast - ePhySectorFirst) + 1UL) == FLS_SIM_BANK_SECTORS))
+    {
+        bRetVal = (boolean)TRUE;
+
+        for (ePhySector = ePhySectorFirst; (ePhySector <= ePhySectorLast) && ((boolean)TRUE == bRetVal); ePhySector++)
+        {
+            if (0U == (*(Fls_pConfigPtr->paSectorUnlock))[ePhySector])
+            {
+                /* the sector stays protected, no block erase over it */
+                bRetVal = (boolean)FALSE;
+            }
+        }
+    }
+
+    return bRetVal;
+}
+#endif
+
+/**
+ * \brief Start the erase of one sector, or of a whole bank with FLS_BLOCK_ERASE
+ *
+ * \param ePhySector physical sector to erase
+ * \param ePhySectorLast last sector of the job on the model, a bank from ePhySector
+ *        up to it is block erased with FLS_BLOCK_ERASE
+ * \param bAsynch not used, completion is always polled
+ * \return FLASH_E_PENDING when the erase is started, FLASH_E_FAILED otherwise
+ */
+static Fls_LLDReturnType Fls_Sim_Erase( const Fls_PhysicalSectorType ePhySector, const Fls_PhysicalSectorType ePhySectorLast,
+                                        const boolean bAsynch )
+{
+    Fls_Sim_SectorStatsType * pStats;
+    Fls_LLDReturnType eRetVal = FLASH_E_FAILED;
+    Fls_PhysicalSectorType eLast = ePhySector;
+    Fls_PhysicalSectorType eSector;
+    uint64_t u64EraseTime = FLS_SIM_ERASE_TIME_US * FLS_SIM_NS_PER_US;
+    uint32 u32Length;
+
+    UNUSED(bAsynch);
+
+#if (FLS_BLOCK_ERASE == STD_ON)
+    if ((boolean)TRUE == Fls_Sim_IsBlockErase(ePhySector, ePhySectorLast))
+    {
+        eLast = ePhySectorLast;
+        u64EraseTime = FLS_SIM_BLOCK_ERASE_TIME_US * FLS_SIM_NS_PER_US;
+    }
+#else
+    UNUSED(ePhySectorLast);
+#endif
+
+    u32Length = (Fls_Sim_SectorOffset(eLast) + (*(Fls_pConfigPtr->paSectorSize))[eLast]) - Fls_Sim_SectorOffset(ePhySector);
+
+    if ((boolean)TRUE == Fls_Sim_IsPowered())
+    {
+        /* schedule async job check for Fls_Sim_MainFunctionErase, or the completion interrupt */
+        Fls_Sim_JobStart(ePhySector, FLASH_JOB_ERASE, FLASH_IRQ_JOB_ERASE);
+        Fls_Sim_eEraseSector = ePhySector;
+        Fls_Sim_eEraseLast = eLast;
+        Fls_Sim_u64BusyUntil = Fls_Sim_u64Now + u64EraseTime;
+
+        /* an erase cut short has erased the start of the run only */
+        (void)Fls_Sim_PowerCut(&u32Length);
+        (void)memset(&Fls_Sim_pImage[Fls_Sim_SectorOffset(ePhySector)], FLS_SIM_ERASED_BYTE, u32Length);
+
+        for (eSector = ePhySector; eSector <= eLast; eSector++)
+        {
+            pStats = Fls_Sim_Stats(eSector);
+
+            if (NULL_PTR != pStats)
+            {
+                pStats->u32EraseCount++;
+            }
+        }
+
+        eRetVal = FLASH_E_PENDING;
+    }
+
+    return eRetVal;
+}
+
+/**
+ * \brief Start programming data within one sector
+ *
+ * The first page is programmed right away, the rest is chained by
+ * Fls_Sim_MainFunctionWrite.
+ *
+ * \return FLASH_E_PENDING when the program is started, FLASH_E_FAILED otherwise
+ */
+static Fls_LLDReturnType Fls_Sim_Write( const Fls_PhysicalSectorType ePhySector, const Fls_AddressType u32SectorOffset,
+                                        const Fls_LengthType u32DataLength, const uint8 * const pDataPtr, const boolean bAsynch )
+{
+    Fls_LLDReturnType eRetVal = FLASH_E_FAILED;
+
+    UNUSED(bAsynch);
+
+    if ((boolean)TRUE == Fls_Sim_IsPowered())
+    {
+        Fls_Sim_eWriteSector = ePhySector;
+        Fls_Sim_u32WriteOffset = Fls_Sim_SectorOffset(ePhySector) + u32SectorOffset;
+        Fls_Sim_pWriteSrc = pDataPtr;
+        Fls_u32LLDRemainingDataToWrite = u32DataLength;
+        Fls_Sim_u64BusyUntil = Fls_Sim_u64Now;
+
+        /* schedule async job check for Fls_Sim_MainFunctionWrite, or the completion interrupt */
+        Fls_Sim_JobStart(ePhySector, FLASH_JOB_WRITE, FLASH_IRQ_JOB_WRITE);
+
+        if ((boolean)TRUE == Fls_Sim_ProgramPage())
+        {
+            eRetVal = FLASH_E_PENDING;
+        }
+        else
+        {
+            Fls_u32LLDRemainingDataToWrite = 0UL;
+            Fls_Sim_JobEnd(MEMIF_JOB_FAILED);
+        }
+    }
+
+    return eRetVal;
+}
+
+static Fls_LLDReturnType Fls_Sim_Read( const Fls_PhysicalSectorType ePhySector, const Fls_AddressType u32SectorOffset,
+                                       Fls_LengthType u32DataLength, uint8 * pDataPtr )
+{
+    Fls_LLDReturnType eRetVal = FLASH_E_FAILED;
+
+    if ((boolean)TRUE == Fls_Sim_IsPowered())
+    {
+        (void)memcpy(pDataPtr, &Fls_Sim_pImage[Fls_Sim_SectorOffset(ePhySector) + u32SectorOffset], u32DataLength);
+        Fls_Sim_ChargeRead(ePhySector, u32DataLength);
+        eRetVal = FLASH_E_OK;
+    }
+
+    return eRetVal;
+}
+
+static Fls_LLDReturnType Fls_Sim_Compare( const Fls_PhysicalSectorType ePhySector, const Fls_AddressType u32SectorOffset,
+                                          Fls_LengthType u32DataLength, const uint8 * pDataPtr )
+{
+    Fls_LLDReturnType eRetVal = FLASH_E_FAILED;
+
+    if ((boolean)TRUE == Fls_Sim_IsPowered())
+    {
+        eRetVal = (0 == memcmp(&Fls_Sim_pImage[Fls_Sim_SectorOffset(ePhySector) + u32SectorOffset], pDataPtr, u32DataLength)) ?
+                  FLASH_E_OK : FLASH_E_BLOCK_INCONSISTENT;
+        Fls_Sim_ChargeRead(ePhySector, u32DataLength);
+    }
+
+    return eRetVal;
+}
+
+static Fls_LLDReturnType Fls_Sim_BlankCheck( const Fls_PhysicalSectorType ePhySector, const Fls_AddressType u32SectorOffset,
+                                             Fls_LengthType u32DataLength )
+{
+    Fls_LLDReturnType eRetVal = FLASH_E_FAILED;
+    uint32 u32Offset;
+    uint32 u32Index;
+
+    if ((boolean)TRUE == Fls_Sim_IsPowered())
+    {
+        eRetVal = FLASH_E_OK;
+        u32Offset = Fls_Sim_SectorOffset(ePhySector) + u32SectorOffset;
+
+        for (u32Index = 0UL; u32Index < u32DataLength; u32Index++)
+        {
+            if (FLS_SIM_ERASED_BYTE != Fls_Sim_pImage[u32Offset + u32Index])
+            {
+                eRetVal = FLASH_E_BLOCK_INCONSISTENT;
+            }
+        }
+
+        Fls_Sim_ChargeRead(ePhySector, u32DataLength);
+    }
+
+    return eRetVal;
+}
+
+/**
+ * \brief Check whether the running erase or program has completed
+ *
+ * In fast forward the virtual clock jumps to the completion time, so time based
+ * figures stay correct without polling through the latency.
+ *
+ * \return TRUE when the operation latency has elapsed
+ */
+static boolean Fls_Sim_Elapsed( void )
+{
+    if (((boolean)TRUE == Fls_Sim_bFastForward) && ((boolean)FALSE == Fls_Sim_bPowerLost) &&
+        (Fls_Sim_u64Now < Fls_Sim_u64BusyUntil))
+    {
+        Fls_Sim_u64Now = Fls_Sim_u64BusyUntil;
+    }
+
+    return (Fls_Sim_u64Now >= Fls_Sim_u64BusyUntil) ? (boolean)TRUE : (boolean)FALSE;
+}
+
+/**
+ * \brief Complete the sector erase once its latency has elapsed
+ */
+static void Fls_Sim_MainFunctionErase( void )
+{
+    if ((boolean)TRUE == Fls_Sim_Elapsed())
+    {
+        /* The sector or bank was successfully erased, move the sector iterator past it */
+        Fls_u32JobSectorIt = Fls_Sim_eEraseLast + 1UL;
+
+        Fls_Sim_JobEnd(MEMIF_JOB_OK);
+    }
+}
+
+/**
+ * \brief Chain the pages of the write whose latency has elapsed
+ */
+static void Fls_Sim_MainFunctionWrite( void )
+{
+    while ((FLASH_JOB_WRITE == Fls_eLLDJob) && ((boolean)TRUE == Fls_Sim_Elapsed()))
+    {
+        if (Fls_u32LLDRemainingDataToWrite > 0UL)
+        {
+            if ((boolean)FALSE == Fls_Sim_ProgramPage())
+            {
+                Fls_u32LLDRemainingDataToWrite = 0UL;
+                Fls_Sim_JobEnd(MEMIF_JOB_FAILED);
+            }
+        }
+        else
+        {
+            /* For a Write Job in ASYNC mode check if Fls_u32JobSectorIt should be increased */
+            if (Fls_u32JobAddrIt > ((*(Fls_pConfigPtr->paSectorEndAddr))[Fls_u32JobSectorIt]))
+            {
+                /* Move on to the next sector */
+                Fls_u32JobSectorIt++;
+            }
+
+            /* program operation succeed */
+            Fls_Sim_JobEnd(MEMIF_JOB_OK);
+        }
+    }
+}
+
+/**
+ * \brief Check whether the model can suspend an erase
+ *
+ * \return TRUE for a sector erase, a block erase can't be suspended
+ */
+static boolean Fls_Sim_EraseSuspendPossible( void )
+{
+    return (Fls_Sim_eEraseLast == Fls_Sim_eEraseSector) ? (boolean)TRUE : (boolean)FALSE;
+}
+
+/**
+ * \brief Suspend the running sector erase
+ *
+ * The array can be read FLS_SIM_SUSPEND_TIME_US after the suspend, the caller
+ * waits for it. The erase time left is kept for Fls_Sim_EraseResume.
+ *
+ * \return FLASH_E_OK when the erase is suspended, FLASH_E_FAILED otherwise
+ */
+static Fls_LLDReturnType Fls_Sim_EraseSuspend( void )
+{
+    Fls_Sim_SectorStatsType * pStats = Fls_Sim_Stats(Fls_Sim_eEraseSector);
+    Fls_LLDReturnType eRetVal = FLASH_E_FAILED;
+
+    if (((boolean)TRUE == Fls_Sim_IsPowered()) && (FLASH_JOB_ERASE == Fls_eLLDJob) &&
+        ((boolean)FALSE == Fls_Sim_bEraseSuspended))
+    {
+        Fls_Sim_u64EraseLeft = (Fls_Sim_u64BusyUntil > Fls_Sim_u64Now) ? (Fls_Sim_u64BusyUntil - Fls_Sim_u64Now) : 0ULL;
+        Fls_Sim_u64Now += FLS_SIM_SUSPEND_TIME_US * FLS_SIM_NS_PER_US;
+        Fls_Sim_bEraseSuspended = (boolean)TRUE;
+
+        if (NULL_PTR != pStats)
+        {
+            pStats->u32EraseSuspends++;
+        }
+
+        eRetVal = FLASH_E_OK;
+    }
+
+    return eRetVal;
+}
+
+/**
+ * \brief Resume the sector erase suspended by Fls_Sim_EraseSuspend
+ *
+ * \return FLASH_E_OK when the erase continues, FLASH_E_FAILED otherwise
+ */
+static Fls_LLDReturnType Fls_Sim_EraseResume( void )
+{
+    Fls_LLDReturnType eRetVal = FLASH_E_FAILED;
+
+    if (((boolean)TRUE == Fls_Sim_IsPowered()) && ((boolean)TRUE == Fls_Sim_bEraseSuspended))
+    {
+        Fls_Sim_u64BusyUntil = Fls_Sim_u64Now + Fls_Sim_u64EraseLeft + (FLS_SIM_RESUME_TIME_US * FLS_SIM_NS_PER_US);
+        Fls_Sim_bEraseSuspended = (boolean)FALSE;
+        eRetVal = FLASH_E_OK;
+    }
+
+    return eRetVal;
+}
+
+/* ################################################################################## */
+/* ############################### Global Functions ################################# */
+
+/**
+ * \brief Write the image back to its file and unmap it
+ */
+void Fls_Sim_Deinit( void )
+{
+    if (NULL_PTR != Fls_Sim_pImage)
+    {
+        (void)msync(Fls_Sim_pImage, Fls_Sim_u32ImageSize, MS_SYNC);
+        (void)munmap(Fls_Sim_pImage, Fls_Sim_u32ImageSize);
+        (void)close(Fls_Sim_iImageFd);
+        Fls_Sim_pImage = NULL_PTR;
+        Fls_Sim_iImageFd = -1;
+    }
+}
+
+/**
+ * \brief Move the virtual clock, e.g. by the Fls_MainFunction period
+ *
+ * Raises the completion interrupt, i.e. calls Fls_IrqHandler, when the latency
+ * of an operation on a FLS_SECTOR_IRQ_MODE sector has elapsed. In fast forward
+ * the operation has always elapsed, a call with u32Us 0 just raises it.
+ *
+ * \param u32Us elapsed time in microseconds
+ */
+void Fls_Sim_AdvanceTime( uint32 u32Us )
+{
+    Fls_Sim_u64Now += (uint64_t)u32Us * FLS_SIM_NS_PER_US;
+
+    if ((FLASH_IRQ_JOB_NONE != Fls_eLLDIrqJob) && ((boolean)TRUE == Fls_Sim_IsPowered()) &&
+        ((boolean)TRUE == Fls_Sim_Elapsed()))
+    {
+        Fls_IrqHandler();
+    }
+}
+
+/**
+ * \brief Switch fast forward on or off
+ *
+ * With fast forward an erase or program completes in the next Fls_MainFunction
+ * call, a whole write job in one call. The virtual clock still advances by the
+ * latencies. Long endurance runs then cost host time for the Fee logic only.
+ *
+ * \param bFastForward TRUE to skip the timing waits
+ */
+void Fls_Sim_SetFastForward( boolean bFastForward )
+{
+    Fls_Sim_bFastForward = bFastForward;
+}
+
+/**
+ * \brief Get the virtual clock, a time base for FLS_GET_TIMESTAMP()
+ *
+ * \return virtual time in microseconds, wrapping
+ */
+uint32 Fls_Sim_GetTime( void )
+{
+    return (uint32)(Fls_Sim_u64Now / FLS_SIM_NS_PER_US);
+}
+
+/**
+ * \brief Get the operation counters of a sector
+ *
+ * \param ePhySector physical sector
+ * \return counters, NULL_PTR if the sector isn't counted
+ */
+const Fls_Sim_SectorStatsType * Fls_Sim_GetSectorStats( const Fls_PhysicalSectorType ePhySector )
+{
+    return Fls_Sim_Stats(ePhySector);
+}
+
+/**
+ * \brief Sum the operation counters of all sectors
+ *
+ * Bytes programmed per user byte of a workload is u32ProgramBytes over the data
+ * length of the Fee jobs, a benchmark takes the difference of two snapshots.
+ *
+ * \param pTotals counters of the whole array
+ */
+void Fls_Sim_GetTotals( Fls_Sim_SectorStatsType * pTotals )
+{
+    uint32 u32Sector;
+
+    (void)memset(pTotals, 0, sizeof(Fls_Sim_SectorStatsType));
+
+    for (u32Sector = 0UL; u32Sector < FLS_SIM_MAX_SECTORS; u32Sector++)
+    {
+        pTotals->u32EraseCount += Fls_Sim_aSectorStats[u32Sector].u32EraseCount;
+        pTotals->u32ProgramCount += Fls_Sim_aSectorStats[u32Sector].u32ProgramCount;
+        pTotals->u32ProgramBytes += Fls_Sim_aSectorStats[u32Sector].u32ProgramBytes;
+        pTotals->u32ReadBytes += Fls_Sim_aSectorStats[u32Sector].u32ReadBytes;
+        pTotals->u32RuleViolations += Fls_Sim_aSectorStats[u32Sector].u32RuleViolations;
+        pTotals->u32EraseSuspends += Fls_Sim_aSectorStats[u32Sector].u32EraseSuspends;
+    }
+}
+
+/**
+ * \brief Clear the operation counters of all sectors
+ */
+void Fls_Sim_ResetStats( void )
+{
+    (void)memset(Fls_Sim_aSectorStats, 0, sizeof(Fls_Sim_aSectorStats));
+}
+
+/**
+ * \brief Arm a power cut
+ *
+ * Power is cut during the erase or program operation u32Operations operations
+ * ahead, 0 being the next one, after u32Bytes bytes of it have been carried out.
+ * u32Bytes 0 cuts at the operation boundary. Fls_Sim_GetOperationCount of a run
+ * without a cut gives the boundaries to iterate over.
+ *
+ * \param u32Operations operations to complete before the cut one
+ * \param u32Bytes bytes of the cut operation written or erased
+ */
+void Fls_Sim_SetPowerFail( uint32 u32Operations, uint32 u32Bytes )
+{
+    Fls_Sim_u32PowerFailOp = Fls_Sim_u32OpCount + u32Operations;
+    Fls_Sim_u32PowerFailBytes = u32Bytes;
+    Fls_Sim_bPowerFailArmed = (boolean)TRUE;
+}
+
+/**
+ * \brief Check whether the armed power cut has happened
+ *
+ * \return TRUE when the model has stopped, the host has to restart
+ */
+boolean Fls_Sim_IsPowerLost( void )
+{
+    return Fls_Sim_bPowerLost;
+}
+
+/**
+ * \brief Get the number of erase and program operations started
+ *
+ * \return operations since the process start
+ */
+uint32 Fls_Sim_GetOperationCount( void )
+{
+    return Fls_Sim_u32OpCount;
+}
+
+/** \brief Backend operations of the host flash model channel, see Fls_ConfigType::paChannelOps */
+const Fls_ChannelOpsType Fls_Sim_tChannelOps =
+{
+    &Fls_Sim_Init,                      /* pfInit */
+    &Fls_Sim_Erase,                     /* pfErase */
+    &Fls_Sim_Write,                     /* pfWrite */
+    &Fls_Sim_Read,                      /* pfRead */
+    &Fls_Sim_Compare,                   /* pfCompare */
+    &Fls_Sim_BlankCheck,                /* pfBlankCheck */
+    &Fls_Sim_MainFunctionErase,         /* pfMainFunctionErase */
+    &Fls_Sim_MainFunctionWrite,         /* pfMainFunctionWrite */
+    NULL_PTR,                           /* pfLockSectors */
+    &Fls_Sim_EraseSuspendPossible,      /* pfEraseSuspendPossible */
+    &Fls_Sim_EraseSuspend,              /* pfEraseSuspend */
+    &Fls_Sim_EraseResume,               /* pfEraseResume */
+    NULL_PTR                            /* pfGetBank */
+};
+
+#endif /* FLS_SIM_BACKEND == STD_ON */